@@ -0,0 +1,148 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file bench.hpp
+ * Minimal self-contained microbenchmark harness. Benchmarks are registered with
+ * the CONTRACTS_BENCHMARK macro and run by bench_main.cpp.
+ */
+
+#ifndef CONTRACTS_BENCH__BENCH_HPP_
+#define CONTRACTS_BENCH__BENCH_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace contracts_lite {
+namespace bench {
+
+/** @brief Prevent the compiler from optimizing away 'value'. */
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const T* sink;
+  sink = &value;
+#endif
+}
+
+/** @brief State passed to a benchmark function. */
+class State {
+ public:
+  explicit State(size_t iterations) : iterations_(iterations) {}
+
+  /** @brief Number of times the benchmark body must run. */
+  size_t iterations() const { return iterations_; }
+
+  /** @brief Set the number of bytes read per iteration (for bandwidth). */
+  void set_bytes_per_iteration(size_t bytes) { bytes_per_iteration_ = bytes; }
+  size_t bytes_per_iteration() const { return bytes_per_iteration_; }
+
+  /** @brief Set the number of items processed per iteration. */
+  void set_items_per_iteration(size_t items) { items_per_iteration_ = items; }
+  size_t items_per_iteration() const { return items_per_iteration_; }
+
+ private:
+  size_t iterations_;
+  size_t bytes_per_iteration_ = 0;
+  size_t items_per_iteration_ = 1;
+};
+
+using Function = void (*)(State&);
+
+/** @brief A registered benchmark. */
+struct Benchmark {
+  std::string name;
+  Function function;
+};
+
+/** @brief Global list of registered benchmarks. */
+inline std::vector<Benchmark>& registry() {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+/** @brief Helper for static registration of benchmarks. */
+struct Registration {
+  Registration(std::string name, Function function) {
+    registry().push_back(Benchmark{std::move(name), function});
+  }
+};
+
+/** @brief Timing result of a single benchmark. */
+struct Result {
+  std::string name;
+  double ns_per_item;
+  double bytes_per_second;
+};
+
+/**
+ * @brief Run a benchmark with increasing iteration counts until a run takes at
+ * least 'min_time_s', then report the fastest of 'repetitions' such runs.
+ */
+inline Result run(const Benchmark& benchmark, double min_time_s = 0.1,
+                  int repetitions = 3) {
+  using clock = std::chrono::steady_clock;
+  size_t iterations = 1;
+  double best_ns = 0.0;
+  size_t bytes = 0;
+  size_t items = 1;
+  for (;;) {
+    State state{iterations};
+    const auto start = clock::now();
+    benchmark.function(state);
+    const auto elapsed =
+        std::chrono::duration<double>(clock::now() - start).count();
+    if (elapsed >= min_time_s) {
+      best_ns = elapsed * 1e9;
+      bytes = state.bytes_per_iteration();
+      items = state.items_per_iteration();
+      break;
+    }
+    const auto scale = (elapsed > 0.0) ? (1.4 * min_time_s / elapsed) : 10.0;
+    iterations = static_cast<size_t>(
+        static_cast<double>(iterations) * ((scale > 10.0) ? 10.0 : scale) + 1);
+  }
+  for (int i = 1; i < repetitions; ++i) {
+    State state{iterations};
+    const auto start = clock::now();
+    benchmark.function(state);
+    const auto elapsed_ns =
+        std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    best_ns = (elapsed_ns < best_ns) ? elapsed_ns : best_ns;
+  }
+  const auto total_items =
+      static_cast<double>(iterations) * static_cast<double>(items);
+  const auto total_bytes =
+      static_cast<double>(iterations) * static_cast<double>(bytes);
+  return Result{benchmark.name, best_ns / total_items,
+                total_bytes / (best_ns * 1e-9)};
+}
+
+}  // namespace bench
+}  // namespace contracts_lite
+
+/** @brief Define and register a benchmark function 'name(State&)'. */
+#define CONTRACTS_BENCHMARK(name)                                         \
+  static void name(::contracts_lite::bench::State& state);                \
+  static const ::contracts_lite::bench::Registration name##_registration( \
+      #name, name);                                                       \
+  static void name(::contracts_lite::bench::State& state)
+
+#endif  // CONTRACTS_BENCH__BENCH_HPP_
@@ -0,0 +1,124 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "bench.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/acute_trig.hpp"
+
+namespace c = contracts_lite;
+namespace b = contracts_lite::bench;
+
+namespace {
+
+/** @brief Number of angles in each batch. */
+constexpr size_t BATCH_SIZE = 1024;
+
+/** @brief Angles evenly spread over the domain of 'Angle'. */
+template <typename Angle>
+std::vector<Angle> angles() {
+  using T = typename Angle::value_type;
+  std::vector<Angle> x;
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    x.emplace_back(Angle::max_value() * static_cast<T>(i) /
+                   static_cast<T>(BATCH_SIZE));
+  }
+  return x;
+}
+
+/** @brief Run 'f' on a batch of angles and an output buffer. */
+template <typename Angle, typename F>
+void run_batch(b::State& state, F f) {
+  using T = typename Angle::value_type;
+  const auto x = angles<Angle>();
+  std::vector<T> out(BATCH_SIZE);
+  state.set_items_per_iteration(BATCH_SIZE);
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    f(x.data(), out.data());
+    b::do_not_optimize(out.data()[i % BATCH_SIZE]);
+  }
+}
+
+/** @brief Baseline: the libm function 'f' applied to each angle. */
+template <typename Angle, typename F>
+void run_libm(b::State& state, F f) {
+  using T = typename Angle::value_type;
+  run_batch<Angle>(state, [f](const Angle* x, T* out) {
+    for (size_t k = 0; k < BATCH_SIZE; ++k) {
+      out[k] = f(static_cast<T>(x[k]));
+    }
+  });
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+#define CONTRACTS_TRIG_BENCHMARKS(name, Angle)                               \
+  CONTRACTS_BENCHMARK(name##_sin_batch) {                                    \
+    run_batch<Angle>(state, [](const Angle* x, Angle::value_type* out) {     \
+      c::sin_batch(x, BATCH_SIZE, out);                                      \
+    });                                                                      \
+  }                                                                          \
+  CONTRACTS_BENCHMARK(name##_std_sin) {                                      \
+    run_libm<Angle>(state, [](Angle::value_type v) { return std::sin(v); }); \
+  }                                                                          \
+  CONTRACTS_BENCHMARK(name##_tan_batch) {                                    \
+    run_batch<Angle>(state, [](const Angle* x, Angle::value_type* out) {     \
+      c::tan_batch(x, BATCH_SIZE, out);                                      \
+    });                                                                      \
+  }                                                                          \
+  CONTRACTS_BENCHMARK(name##_std_tan) {                                      \
+    run_libm<Angle>(state, [](Angle::value_type v) { return std::tan(v); }); \
+  }
+
+CONTRACTS_TRIG_BENCHMARKS(acute_radian_float, c::AcuteRadian<float>)
+CONTRACTS_TRIG_BENCHMARKS(acute_radian_double, c::AcuteRadian<double>)
+
+#undef CONTRACTS_TRIG_BENCHMARKS
+
+//------------------------------------------------------------------------------
+
+/** @brief sincos of degrees, against libm converting to radians. */
+CONTRACTS_BENCHMARK(acute_degree_float_sincos_batch) {
+  using Angle = c::AcuteDegree<float>;
+  const auto x = angles<Angle>();
+  std::vector<float> s(BATCH_SIZE), co(BATCH_SIZE);
+  state.set_items_per_iteration(BATCH_SIZE);
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    c::sincos_batch(x.data(), BATCH_SIZE, s.data(), co.data());
+    b::do_not_optimize(s.data()[i % BATCH_SIZE]);
+    b::do_not_optimize(co.data()[i % BATCH_SIZE]);
+  }
+}
+
+CONTRACTS_BENCHMARK(acute_degree_float_std_sincos) {
+  using Angle = c::AcuteDegree<float>;
+  const auto x = angles<Angle>();
+  const float k = static_cast<float>(M_PI / 180.0);
+  std::vector<float> s(BATCH_SIZE), co(BATCH_SIZE);
+  state.set_items_per_iteration(BATCH_SIZE);
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    for (size_t j = 0; j < BATCH_SIZE; ++j) {
+      const float r = static_cast<float>(x[j]) * k;
+      s[j] = std::sin(r);
+      co[j] = std::cos(r);
+    }
+    b::do_not_optimize(s.data()[i % BATCH_SIZE]);
+    b::do_not_optimize(co.data()[i % BATCH_SIZE]);
+  }
+}
@@ -0,0 +1,65 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <vector>
+
+#include "bench.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/bounded_vector.hpp"
+
+namespace c = contracts_lite;
+namespace b = contracts_lite::bench;
+
+namespace {
+
+/** @brief Number of elements in each container. */
+constexpr size_t FILL_SIZE = 64;
+
+/**
+ * @brief Fill a fresh container and sum its elements, as a real-time loop
+ * would do with per-cycle scratch storage.
+ */
+template <typename Container, typename Prepare>
+void fill_and_sum(b::State& state, Prepare prepare) {
+  state.set_items_per_iteration(FILL_SIZE);
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    Container v;
+    prepare(v);
+    for (size_t k = 0; k < FILL_SIZE; ++k) {
+      v.push_back(static_cast<float>(k));
+    }
+    float sum = 0.0f;
+    for (const auto x : v) {
+      sum += x;
+    }
+    b::do_not_optimize(sum);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(bounded_vector_fill_and_sum) {
+  fill_and_sum<c::BoundedVector<float, FILL_SIZE>>(state, [](auto&) {});
+}
+
+/** @brief Baseline: a heap-allocated vector with the capacity reserved. */
+CONTRACTS_BENCHMARK(std_vector_reserve_fill_and_sum) {
+  fill_and_sum<std::vector<float>>(state,
+                                   [](auto& v) { v.reserve(FILL_SIZE); });
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,61 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <vector>
+
+#include "bench.hpp"
+#include "contracts_lite/float16.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+
+namespace c = contracts_lite;
+namespace b = contracts_lite::bench;
+
+namespace {
+
+/** @brief Number of values in each buffer. */
+constexpr size_t BUFFER_SIZE = 4096;
+
+/** @brief Validate a buffer of values in [0, 1] stored as 'T'. */
+template <typename T>
+void check_buffer(b::State& state) {
+  std::vector<T> buffer;
+  for (size_t i = 0; i < BUFFER_SIZE; ++i) {
+    buffer.emplace_back(static_cast<float>(i) / BUFFER_SIZE);
+  }
+  state.set_items_per_iteration(BUFFER_SIZE);
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    const bool valid =
+        c::UnitReal<T>::check_batch(buffer.data(), buffer.size()).status;
+    b::do_not_optimize(valid);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(unit_real_check_batch_float16) {
+  check_buffer<c::float16>(state);
+}
+
+CONTRACTS_BENCHMARK(unit_real_check_batch_bfloat16) {
+  check_buffer<c::bfloat16>(state);
+}
+
+/** @brief Baseline: the same buffer stored as float. */
+CONTRACTS_BENCHMARK(unit_real_check_batch_float) {
+  check_buffer<float>(state);
+}
@@ -0,0 +1,43 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <cstring>
+
+#include "bench.hpp"
+
+/**
+ * @brief Run all registered benchmarks whose name contains argv[1] (or all
+ * benchmarks if no argument is given) and print a table of the results.
+ */
+int main(int argc, char** argv) {
+  namespace b = contracts_lite::bench;
+  const char* filter = (argc > 1) ? argv[1] : "";
+
+  std::printf("%-48s %12s %12s\n", "benchmark", "ns/item", "MB/s");
+  for (const auto& benchmark : b::registry()) {
+    if (std::strstr(benchmark.name.c_str(), filter) == nullptr) {
+      continue;
+    }
+    const auto result = b::run(benchmark);
+    if (result.bytes_per_second > 0.0) {
+      std::printf("%-48s %12.3f %12.1f\n", result.name.c_str(),
+                  result.ns_per_item, result.bytes_per_second * 1e-6);
+    } else {
+      std::printf("%-48s %12.3f %12s\n", result.name.c_str(),
+                  result.ns_per_item, "-");
+    }
+  }
+  return 0;
+}
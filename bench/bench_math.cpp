@@ -0,0 +1,100 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "bench.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/math.hpp"
+
+namespace c = contracts_lite;
+namespace b = contracts_lite::bench;
+
+namespace {
+
+/** @brief Number of values in each batch. */
+constexpr size_t BATCH_SIZE = 1024;
+
+/** @brief Apply 'f' to a batch of positive reals. */
+template <typename T, typename F>
+void apply_batch(b::State& state, F f) {
+  std::vector<c::NonnegativeReal<T>> x;
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    x.emplace_back(static_cast<T>(i) + static_cast<T>(0.5));
+  }
+  std::vector<T> out(BATCH_SIZE);
+  state.set_items_per_iteration(BATCH_SIZE);
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    for (size_t k = 0; k < BATCH_SIZE; ++k) {
+      out[k] = f(x[k]);
+    }
+    b::do_not_optimize(out.data()[i % BATCH_SIZE]);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(sqrt_nonnegative_real_float) {
+  apply_batch<float>(state, [](c::NonnegativeReal<float> x) {
+    return static_cast<float>(c::sqrt(x));
+  });
+}
+
+/** @brief Baseline: libm, with its domain check and errno handling. */
+CONTRACTS_BENCHMARK(std_sqrt_float) {
+  apply_batch<float>(state, [](c::NonnegativeReal<float> x) {
+    return std::sqrt(static_cast<float>(x));
+  });
+}
+
+/** @brief Baseline: libm, with the result checked into a contract type. */
+CONTRACTS_BENCHMARK(std_sqrt_checked_float) {
+  apply_batch<float>(state, [](c::NonnegativeReal<float> x) {
+    return static_cast<float>(
+        c::NonnegativeReal<float>(std::sqrt(static_cast<float>(x))));
+  });
+}
+
+CONTRACTS_BENCHMARK(sqrt_nonnegative_real_double) {
+  apply_batch<double>(state, [](c::NonnegativeReal<double> x) {
+    return static_cast<double>(c::sqrt(x));
+  });
+}
+
+CONTRACTS_BENCHMARK(std_sqrt_double) {
+  apply_batch<double>(state, [](c::NonnegativeReal<double> x) {
+    return std::sqrt(static_cast<double>(x));
+  });
+}
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(log_strictly_positive_real_double) {
+  apply_batch<double>(state, [](c::NonnegativeReal<double> x) {
+    return static_cast<double>(
+        c::log(c::StrictlyPositiveReal<double>(x, c::assume_valid)));
+  });
+}
+
+/** @brief Baseline: libm, with the result checked into a contract type. */
+CONTRACTS_BENCHMARK(std_log_checked_double) {
+  apply_batch<double>(state, [](c::NonnegativeReal<double> x) {
+    const c::Real<double> r(std::log(static_cast<double>(x)));
+    return static_cast<double>(r);
+  });
+}
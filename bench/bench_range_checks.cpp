@@ -0,0 +1,214 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "bench.hpp"
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/strictly_positive_odd_integer.hpp"
+
+namespace c = contracts_lite;
+namespace b = contracts_lite::bench;
+namespace rc = contracts_lite::range_checks;
+
+namespace {
+
+/** @brief Number of values checked per iteration. */
+constexpr size_t INPUT_SIZE = 1024;
+
+/**
+ * @brief Number of random values checked per iteration: enough that branch
+ * predictors cannot learn the outcomes over iterations.
+ */
+constexpr size_t RANDOM_INPUT_SIZE = 1024u * 1024u;
+
+/** @brief Values in (0, 1). */
+std::vector<float> unit_inputs() {
+  std::vector<float> inputs;
+  for (size_t i = 0; i < INPUT_SIZE; ++i) {
+    inputs.push_back((static_cast<float>(i) + 0.5f) / INPUT_SIZE);
+  }
+  return inputs;
+}
+
+/**
+ * @brief Evaluate 'check' on each of 'inputs' and consume the status. The
+ * comment is built or not according to the build level (see CONTRACT_COMMENT).
+ */
+template <typename Check>
+void evaluate(b::State& state, const std::vector<float>& inputs, Check check) {
+  state.set_items_per_iteration(inputs.size());
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    for (const auto v : inputs) {
+      const c::ReturnStatus status = check(v);
+      const bool ok = status.status;
+      b::do_not_optimize(ok);
+    }
+  }
+}
+
+/**
+ * @brief Random values from 'distribution', with a fixed seed. The ranges of
+ * the benchmarks below make the outcomes of the comparisons of a check (and so
+ * any branches on them) unpredictable.
+ */
+template <typename Distribution>
+std::vector<typename Distribution::result_type> random_inputs(
+    Distribution distribution) {
+  std::mt19937 generator(42u);
+  std::vector<typename Distribution::result_type> inputs;
+  for (size_t i = 0; i < RANDOM_INPUT_SIZE; ++i) {
+    inputs.push_back(distribution(generator));
+  }
+  return inputs;
+}
+
+/**
+ * @brief Evaluate 'check' on each of 'inputs', and branch on the status, as
+ * code filtering untrusted values would. The compiler cannot turn the branch
+ * into a select, since each side has a side effect, so a check that is
+ * compiled to more than one branch mispredicts more often.
+ */
+template <typename T, typename Check>
+void filter(b::State& state, const std::vector<T>& inputs, Check check) {
+  state.set_items_per_iteration(inputs.size());
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    size_t valid = 0;
+    for (const auto v : inputs) {
+      if (check(v).status) {
+        ++valid;
+        b::do_not_optimize(valid);
+      } else {
+        b::do_not_optimize(v);
+      }
+    }
+    b::do_not_optimize(valid);
+  }
+}
+
+/** @brief Bounds that the compiler cannot fold into the checks. */
+template <typename T>
+T opaque(T value) {
+  const volatile T copy = value;
+  return copy;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(range_check_open_open) {
+  evaluate(state, unit_inputs(),
+           [](float v) { return rc::in_range_open_open(v, 0.0f, 1.0f); });
+}
+
+CONTRACTS_BENCHMARK(range_check_closed_open) {
+  evaluate(state, unit_inputs(),
+           [](float v) { return rc::in_range_closed_open(v, 0.0f, 1.0f); });
+}
+
+CONTRACTS_BENCHMARK(range_check_open_closed) {
+  evaluate(state, unit_inputs(),
+           [](float v) { return rc::in_range_open_closed(v, 0.0f, 1.0f); });
+}
+
+CONTRACTS_BENCHMARK(range_check_closed_closed) {
+  evaluate(state, unit_inputs(),
+           [](float v) { return rc::in_range_closed_closed(v, 0.0f, 1.0f); });
+}
+
+//------------------------------------------------------------------------------
+
+/** @brief A third of the values each below, inside and above [0, 1]. */
+CONTRACTS_BENCHMARK(range_check_random_float) {
+  const float lo = opaque(0.0f);
+  const float hi = opaque(1.0f);
+  filter(state,
+         random_inputs(std::uniform_real_distribution<float>(-1.0f, 2.0f)),
+         [lo, hi](float v) { return rc::in_range_closed_closed(v, lo, hi); });
+}
+
+/** @brief A third of the values each below, inside and above [0, 100). */
+CONTRACTS_BENCHMARK(range_check_random_int) {
+  const int lo = opaque(0);
+  const int hi = opaque(100);
+  filter(state, random_inputs(std::uniform_int_distribution<int>(-100, 199)),
+         [lo, hi](int v) { return rc::in_range_closed_open(v, lo, hi); });
+}
+
+/** @brief Half of the values are negative, and half are even. */
+CONTRACTS_BENCHMARK(odd_integer_check_random) {
+  filter(state, random_inputs(std::uniform_int_distribution<int>(-100, 99)),
+         [](int v) { return c::StrictlyPositiveOddInteger<int>::check(v); });
+}
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(return_status_and) {
+  evaluate(state, unit_inputs(), [](float v) {
+    return rc::in_range_closed_closed(v, 0.0f, 1.0f) &&
+           rc::in_range_open_open(v, -1.0f, 2.0f);
+  });
+}
+
+CONTRACTS_BENCHMARK(return_status_or) {
+  evaluate(state, unit_inputs(), [](float v) {
+    return rc::in_range_closed_closed(v, 2.0f, 3.0f) ||
+           rc::in_range_open_open(v, -1.0f, 2.0f);
+  });
+}
+
+/** @brief Combining statuses with long comments, which must be joined. */
+CONTRACTS_BENCHMARK(return_status_and_comments) {
+  evaluate(state, unit_inputs(), [](float v) {
+    return c::ReturnStatus("value must be in the unit interval", v <= 1.0f) &&
+           c::ReturnStatus("value must be nonnegative", v >= 0.0f);
+  });
+}
+
+//------------------------------------------------------------------------------
+
+/** @brief A DEFAULT_ENFORCE that passes. */
+CONTRACTS_BENCHMARK(enforce_pass) {
+  evaluate(state, unit_inputs(), [](float v) {
+    static_cast<void>(v);  // Unused at the OFF build level.
+    DEFAULT_ENFORCE(rc::in_range_closed_closed(v, 0.0f, 1.0f));
+    return c::ReturnStatus("", true);
+  });
+}
+
+#ifdef CONTRACT_VIOLATION_CONTINUATION_MODE_ON
+/**
+ * @brief A DEFAULT_ENFORCE that fails, with the violation handler throwing
+ * (continuation mode). This includes building the violation and unwinding.
+ * Nothing is enforced at the OFF build level.
+ */
+CONTRACTS_BENCHMARK(enforce_violation) {
+  evaluate(state, unit_inputs(), [](float v) {
+    static_cast<void>(v);  // Unused at the OFF build level.
+    try {
+      DEFAULT_ENFORCE(rc::in_range_closed_closed(v, 2.0f, 3.0f));
+    } catch (const std::runtime_error&) {
+      return c::ReturnStatus("", false);
+    }
+    return c::ReturnStatus("", true);
+  });
+}
+#endif
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,59 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include "bench.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+
+namespace c = contracts_lite;
+namespace b = contracts_lite::bench;
+
+namespace {
+
+/** @brief Number of elements scanned per iteration (larger than the LLC). */
+constexpr size_t SCAN_SIZE = 16u * 1024u * 1024u;
+
+/** @brief Sum all elements of an array of size bounds. */
+template <size_t BOUND>
+void scan(b::State& state) {
+  static const std::vector<c::SizeBound<BOUND>> data(SCAN_SIZE,
+                                                     c::SizeBound<BOUND>{1});
+  state.set_bytes_per_iteration(SCAN_SIZE * sizeof(c::SizeBound<BOUND>));
+  state.set_items_per_iteration(SCAN_SIZE);
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    size_t sum = 0;
+    for (const auto& s : data) {
+      sum += s;
+    }
+    b::do_not_optimize(sum);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(size_bound_scan_uint8) { scan<UINT8_MAX>(state); }
+
+CONTRACTS_BENCHMARK(size_bound_scan_uint16) { scan<UINT16_MAX>(state); }
+
+CONTRACTS_BENCHMARK(size_bound_scan_uint32) { scan<UINT32_MAX>(state); }
+
+/** @brief Baseline: the storage size before compaction. */
+CONTRACTS_BENCHMARK(size_bound_scan_size_t) { scan<SIZE_MAX>(state); }
+
+//------------------------------------------------------------------------------
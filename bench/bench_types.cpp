@@ -0,0 +1,212 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "bench.hpp"
+#include "contracts_lite/float16.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/acute_degree.hpp"
+#include "contracts_lite/types/acute_radian.hpp"
+#include "contracts_lite/types/bounded_vector.hpp"
+#include "contracts_lite/types/covariance_matrix.hpp"
+#include "contracts_lite/types/monotonic_sequence.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/nonzero_real.hpp"
+#include "contracts_lite/types/probability_simplex.hpp"
+#include "contracts_lite/types/quantity.hpp"
+#include "contracts_lite/types/ranged.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/rotation_matrix3.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/strictly_positive_odd_integer.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "contracts_lite/types/unit_quaternion.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "contracts_lite/types/unit_vector3.hpp"
+
+namespace c = contracts_lite;
+namespace b = contracts_lite::bench;
+
+namespace {
+
+/** @brief Number of (valid) inputs constructed per iteration. */
+constexpr size_t INPUT_SIZE = 1024;
+
+/**
+ * @brief Construct an object from each of 'inputs' with 'make', which must
+ * return the constructed object. At the OFF build level this measures the
+ * cost of the bare construction.
+ */
+template <typename Input, typename Make>
+void construct(b::State& state, const std::vector<Input>& inputs, Make make) {
+  state.set_items_per_iteration(inputs.size());
+  for (size_t i = 0; i < state.iterations(); ++i) {
+    for (const auto& input : inputs) {
+      const auto object = make(input);
+      b::do_not_optimize(object);
+    }
+  }
+}
+
+/** @brief Inputs in (0, 1), valid for all of the bounded real types. */
+std::vector<float> unit_inputs() {
+  std::vector<float> inputs;
+  for (size_t i = 0; i < INPUT_SIZE; ++i) {
+    inputs.push_back((static_cast<float>(i) + 0.5f) / INPUT_SIZE);
+  }
+  return inputs;
+}
+
+/** @brief Angles in (0, pi/2), of which sines and cosines form inputs. */
+std::vector<float> angles() {
+  std::vector<float> inputs = unit_inputs();
+  for (auto& a : inputs) {
+    a *= 1.5f;
+  }
+  return inputs;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+#define CONTRACTS_BENCH_SCALAR(name, T)                            \
+  CONTRACTS_BENCHMARK(name) {                                      \
+    construct(state, unit_inputs(), [](float v) { return T(v); }); \
+  }                                                                \
+  CONTRACTS_BENCHMARK(name##_assume_valid) {                       \
+    construct(state, unit_inputs(),                                \
+              [](float v) { return T(v, c::assume_valid); });      \
+  }
+
+CONTRACTS_BENCH_SCALAR(construct_real, c::Real<float>)
+CONTRACTS_BENCH_SCALAR(construct_unit_real, c::UnitReal<float>)
+CONTRACTS_BENCH_SCALAR(construct_nonnegative_real, c::NonnegativeReal<float>)
+CONTRACTS_BENCH_SCALAR(construct_strictly_positive_real,
+                       c::StrictlyPositiveReal<float>)
+CONTRACTS_BENCH_SCALAR(construct_nonzero_real, c::NonzeroReal<float>)
+CONTRACTS_BENCH_SCALAR(construct_acute_radian, c::AcuteRadian<float>)
+CONTRACTS_BENCH_SCALAR(construct_acute_degree, c::AcuteDegree<float>)
+
+using UnitRanged = c::Ranged<float, std::ratio<0>, std::ratio<1>>;
+CONTRACTS_BENCH_SCALAR(construct_ranged, UnitRanged)
+
+using Meters = c::units::Meters<c::NonnegativeReal<float>>;
+CONTRACTS_BENCH_SCALAR(construct_quantity, Meters)
+
+#undef CONTRACTS_BENCH_SCALAR
+
+CONTRACTS_BENCHMARK(construct_unit_real_float16) {
+  std::vector<c::float16> inputs;
+  for (const auto v : unit_inputs()) {
+    inputs.emplace_back(v);
+  }
+  construct(state, inputs,
+            [](c::float16 v) { return c::UnitReal<c::float16>(v); });
+}
+
+CONTRACTS_BENCHMARK(construct_size_bound) {
+  std::vector<size_t> inputs;
+  for (size_t i = 0; i < INPUT_SIZE; ++i) {
+    inputs.push_back(i % 256);
+  }
+  construct(state, inputs, [](size_t v) { return c::SizeBound<255>(v); });
+}
+
+CONTRACTS_BENCHMARK(construct_strictly_positive_odd_integer) {
+  std::vector<int> inputs;
+  for (size_t i = 0; i < INPUT_SIZE; ++i) {
+    inputs.push_back(static_cast<int>(2 * i + 1));
+  }
+  construct(state, inputs,
+            [](int v) { return c::StrictlyPositiveOddInteger<int>(v); });
+}
+
+//------------------------------------------------------------------------------
+
+CONTRACTS_BENCHMARK(construct_unit_vector3) {
+  std::vector<std::array<float, 3>> inputs;
+  for (const auto a : angles()) {
+    inputs.push_back({{std::cos(a), std::sin(a), 0.0f}});
+  }
+  construct(state, inputs, [](const std::array<float, 3>& v) {
+    return c::UnitVector3<float>(v[0], v[1], v[2]);
+  });
+}
+
+CONTRACTS_BENCHMARK(construct_unit_quaternion) {
+  std::vector<std::array<float, 4>> inputs;
+  for (const auto a : angles()) {
+    inputs.push_back({{std::cos(a), 0.0f, 0.0f, std::sin(a)}});
+  }
+  construct(state, inputs, [](const std::array<float, 4>& q) {
+    return c::UnitQuaternion<float>(q[0], q[1], q[2], q[3]);
+  });
+}
+
+CONTRACTS_BENCHMARK(construct_rotation_matrix3) {
+  std::vector<std::array<float, 9>> inputs;
+  for (const auto a : angles()) {
+    const auto co = std::cos(a);
+    const auto si = std::sin(a);
+    inputs.push_back({{co, -si, 0.0f, si, co, 0.0f, 0.0f, 0.0f, 1.0f}});
+  }
+  construct(state, inputs, [](const std::array<float, 9>& m) {
+    return c::RotationMatrix3<float>(m);
+  });
+}
+
+CONTRACTS_BENCHMARK(construct_covariance_matrix3) {
+  using C3 = c::CovarianceMatrix<double, 3>;
+  std::vector<C3::array_type> inputs;
+  for (const auto v : unit_inputs()) {
+    const double d = 1.0 + v;
+    const double o = 0.5 * v;
+    inputs.push_back({{d, o, 0.0, o, d, o, 0.0, o, d}});
+  }
+  construct(state, inputs, [](const C3::array_type& m) { return C3(m); });
+}
+
+CONTRACTS_BENCHMARK(construct_probability_simplex3) {
+  std::vector<std::array<float, 3>> inputs;
+  for (const auto v : unit_inputs()) {
+    inputs.push_back({{0.5f * v, 0.5f, 0.5f - 0.5f * v}});
+  }
+  construct(state, inputs, [](const std::array<float, 3>& p) {
+    return c::ProbabilitySimplex<float, 3>(p);
+  });
+}
+
+CONTRACTS_BENCHMARK(construct_bounded_vector4) {
+  construct(state, unit_inputs(), [](float v) {
+    return c::BoundedVector<float, 8>{v, v, v, v};
+  });
+}
+
+/** @brief Appending is the checked operation of monotonic sequences. */
+CONTRACTS_BENCHMARK(append_monotonic_sequence8) {
+  construct(state, unit_inputs(), [](float v) {
+    c::MonotonicSequence<float, 8> s;
+    for (int i = 0; i < 8; ++i) {
+      s.push_back(v + static_cast<float>(i));
+    }
+    return s;
+  });
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,93 @@
+#!/bin/bash
+# Copyright 2021 Mapless AI, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compare the build time of a synthetic project of many TUs using the
+# contract types: with the headers, and with the precompiled header
+# (contracts_lite_pch) where CMake supports it.
+#
+# Usage: bench/build_time.sh [<TUs> [<jobs>]]
+#
+# Each variant is configured in its own build directory, and the time is the
+# wall-clock time of building the project, including the precompiled header.
+
+set -e
+
+TUS=${1:-64}
+JOBS=${2:-$(nproc)}
+SOURCE=$(cd "$(dirname "$0")/.." && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "${WORK}"' EXIT
+
+PROJECT="${WORK}/project"
+mkdir -p "${PROJECT}/src"
+cat > "${PROJECT}/CMakeLists.txt" <<CMAKE
+cmake_minimum_required(VERSION 3.16)
+project(build_time CXX)
+set(CMAKE_CXX_STANDARD 14)
+add_subdirectory("${SOURCE}" contracts_lite)
+file(GLOB SOURCES src/*.cpp)
+add_library(synthetic STATIC \${SOURCES})
+if(VARIANT STREQUAL "pch")
+  target_link_libraries(synthetic contracts_lite_pch)
+else()
+  target_link_libraries(synthetic contracts_lite)
+endif()
+CMAKE
+
+for ((i = 0; i < TUS; ++i)); do
+  cat > "${PROJECT}/src/tu_${i}.cpp" <<TU
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/bounded_vector.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "contracts_lite/types/unit_vector3.hpp"
+
+float tu_${i}(float x, float y, unsigned n) {
+  const contracts_lite::UnitReal<float> u(x);
+  const contracts_lite::NonnegativeReal<float> r(y);
+  const contracts_lite::SizeBound<8> s(n);
+  const auto v = contracts_lite::UnitVector3<float>::normalize(x, y, 1.0f);
+  contracts_lite::BoundedVector<float, 8> b;
+  b.resize(s, u * r);
+  return b.back() + v.dot(-v) + ${i}.0f;
+}
+TU
+done
+
+# Print the time to build variant $1 in ms, or "-" if it does not configure.
+build_ms() {
+  local build="${WORK}/build_$1"
+  local options=(-DVARIANT="$1" -DCMAKE_BUILD_TYPE=Release)
+  if ! cmake -S "${PROJECT}" -B "${build}" "${options[@]}" \
+      > "${build}.log" 2>&1; then
+    echo "-"
+    return
+  fi
+  local start end
+  start=$(date +%s%N)
+  if ! cmake --build "${build}" -j "${JOBS}" >> "${build}.log" 2>&1; then
+    echo "-"
+    return
+  fi
+  end=$(date +%s%N)
+  echo $(((end - start) / 1000000))
+}
+
+printf "%-10s %12s\n" "variant" "ms"
+for VARIANT in headers pch; do
+  printf "%-10s %12s\n" "${VARIANT}" "$(build_ms "${VARIANT}")"
+done
+echo "(${TUS} TUs, ${JOBS} jobs; '-': not supported by this CMake)"
@@ -0,0 +1,79 @@
+#!/bin/bash
+# Copyright 2021 Mapless AI, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compare the compile time of a synthetic TU using the contract types with
+# and without iostreams, which the core headers used to include.
+#
+# Usage: bench/compile_time.sh [<compiler> [<repetitions>]]
+#
+# The times are wall-clock times of -fsyntax-only, i.e., of parsing and
+# instantiation, which is what the headers cost. For a breakdown, compile the
+# TUs with -ftime-trace (clang) or -ftime-report (GCC).
+
+set -e
+
+CXX=${1:-${CXX:-c++}}
+REPETITIONS=${2:-20}
+INCLUDE=$(cd "$(dirname "$0")/../include" && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "${WORK}"' EXIT
+
+cat > "${WORK}/core.cpp" <<'TU'
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+
+float f(float x, float y, unsigned i) {
+  const contracts_lite::UnitReal<float> u(x);
+  const contracts_lite::NonnegativeReal<float> n(y);
+  const contracts_lite::SizeBound<16> s(i);
+  return u * n + static_cast<float>(s);
+}
+TU
+# The same TU, also paying for the iostream headers.
+{
+  echo '#include <iostream>'
+  echo '#include <sstream>'
+  cat "${WORK}/core.cpp"
+} > "${WORK}/iostream.cpp"
+
+FLAGS=(-std=c++14 -I"${INCLUDE}")
+
+# Print the total compile time of 'REPETITIONS' compilations of TU $1, in ms.
+compile_ms() {
+  local total=0
+  for ((i = 0; i < REPETITIONS; ++i)); do
+    local start end
+    start=$(date +%s%N)
+    "${CXX}" "${FLAGS[@]}" -fsyntax-only "${WORK}/$1.cpp"
+    end=$(date +%s%N)
+    total=$((total + (end - start) / 1000000))
+  done
+  echo "${total}"
+}
+
+# Print the number of preprocessed lines of TU $1.
+lines() {
+  "${CXX}" "${FLAGS[@]}" -E "${WORK}/$1.cpp" | wc -l
+}
+
+printf "%-12s %16s %12s\n" "headers" "preprocessed" "ms/TU"
+for TU in core iostream; do
+  MS=$(compile_ms "${TU}")
+  printf "%-12s %16s %12s\n" "${TU}" "$(lines "${TU}")" \
+    "$((MS / REPETITIONS))"
+done
+echo "(${CXX}, ${REPETITIONS} repetitions)"
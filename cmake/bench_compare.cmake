@@ -0,0 +1,157 @@
+# Copyright 2021 Mapless AI, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Run the benchmarks built at each contract build level and print a table
+# comparing their times.
+#
+# Usage:
+#   cmake -DBENCH_OFF=<exe> -DBENCH_DEFAULT=<exe> -DBENCH_AUDIT=<exe>
+#         [-DFILTER=<substring>] -P bench_compare.cmake
+#   cmake -DSELF_TEST=ON -P bench_compare.cmake
+#
+# Each executable prints a table of "<name> <ns/item> <MB/s>" lines (see
+# bench/bench_main.cpp). The comparison has one ns/item column per level, and
+# the ratio of the DEFAULT and AUDIT times to the OFF time. The ratios are
+# checked on known values before every run, and with SELF_TEST, only they are.
+
+# Left-pad 'TEXT' with spaces to 'WIDTH' characters, into 'OUT'.
+function(pad OUT TEXT WIDTH)
+  set(RESULT "${TEXT}")
+  string(LENGTH "${RESULT}" LENGTH)
+  while(LENGTH LESS WIDTH)
+    set(RESULT " ${RESULT}")
+    math(EXPR LENGTH "${LENGTH} + 1")
+  endwhile()
+  set(${OUT} "${RESULT}" PARENT_SCOPE)
+endfunction()
+
+# Right-pad 'TEXT' with spaces to 'WIDTH' characters, into 'OUT'.
+function(pad_right OUT TEXT WIDTH)
+  set(RESULT "${TEXT}")
+  string(LENGTH "${RESULT}" LENGTH)
+  while(LENGTH LESS WIDTH)
+    set(RESULT "${RESULT} ")
+    math(EXPR LENGTH "${LENGTH} + 1")
+  endwhile()
+  set(${OUT} "${RESULT}" PARENT_SCOPE)
+endfunction()
+
+# Time 'NS' (with three decimals) relative to 'BASE', as "<r>.<rr>x".
+function(ratio OUT NS BASE)
+  foreach(VAR NS BASE)
+    string(REPLACE "." "" ${VAR} "${${VAR}}")
+    # Strip the leading zeros. (A '^'-anchored REGEX REPLACE would be applied
+    # again after each match, and also strip zeros inside the number.)
+    string(REGEX MATCH "[1-9][0-9]*$" ${VAR} "${${VAR}}")
+    if("${${VAR}}" STREQUAL "")
+      set(${VAR} 0)
+    endif()
+  endforeach()
+  if(BASE EQUAL 0)
+    set(${OUT} "-" PARENT_SCOPE)
+    return()
+  endif()
+  math(EXPR HUNDREDTHS "(${NS} * 100 + ${BASE} / 2) / ${BASE}")
+  math(EXPR UNITS "${HUNDREDTHS} / 100")
+  math(EXPR FRACTION "${HUNDREDTHS} % 100")
+  if(FRACTION LESS 10)
+    set(FRACTION "0${FRACTION}")
+  endif()
+  set(${OUT} "${UNITS}.${FRACTION}x" PARENT_SCOPE)
+endfunction()
+
+# Each case is "<ns>;<base>;<expected ratio>".
+foreach(CASE "2.243;0.708;3.17x" "0.489;0.403;1.21x" "0.708;0.708;1.00x"
+             "10.050;1.005;10.00x" "0.000;0.040;0.00x" "1.000;0.000;-")
+  list(GET CASE 0 NS)
+  list(GET CASE 1 BASE)
+  list(GET CASE 2 EXPECTED)
+  ratio(ACTUAL "${NS}" "${BASE}")
+  if(NOT ACTUAL STREQUAL EXPECTED)
+    message(FATAL_ERROR
+      "bench_compare: ratio of ${NS} to ${BASE} is ${ACTUAL}, not ${EXPECTED}")
+  endif()
+endforeach()
+if(SELF_TEST)
+  return()
+endif()
+
+set(LEVELS OFF DEFAULT AUDIT)
+foreach(LEVEL ${LEVELS})
+  if(NOT DEFINED BENCH_${LEVEL})
+    message(FATAL_ERROR "bench_compare: BENCH_${LEVEL} must be defined")
+  endif()
+endforeach()
+
+set(NAMES)
+foreach(LEVEL ${LEVELS})
+  message(STATUS "Running benchmarks at the ${LEVEL} build level")
+  execute_process(COMMAND ${BENCH_${LEVEL}} ${FILTER}
+    OUTPUT_VARIABLE OUTPUT
+    RESULT_VARIABLE RESULT)
+  if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "bench_compare: ${BENCH_${LEVEL}} failed: ${RESULT}")
+  endif()
+  string(REPLACE "\n" ";" LINES "${OUTPUT}")
+  foreach(LINE ${LINES})
+    if(LINE MATCHES "^([A-Za-z0-9_]+) +([0-9]+\\.[0-9]+) ")
+      set(NAME "${CMAKE_MATCH_1}")
+      set(NS_${LEVEL}_${NAME} "${CMAKE_MATCH_2}")
+      list(FIND NAMES "${NAME}" INDEX)
+      if(INDEX EQUAL -1)
+        list(APPEND NAMES "${NAME}")
+      endif()
+    endif()
+  endforeach()
+endforeach()
+
+set(NAME_WIDTH 40)
+foreach(NAME ${NAMES})
+  string(LENGTH "${NAME}" LENGTH)
+  if(LENGTH GREATER NAME_WIDTH)
+    set(NAME_WIDTH ${LENGTH})
+  endif()
+endforeach()
+
+pad_right(ROW "benchmark (ns/item)" ${NAME_WIDTH})
+foreach(COLUMN ${LEVELS} "DEFAULT/OFF" "AUDIT/OFF")
+  pad(CELL "${COLUMN}" 12)
+  string(APPEND ROW "${CELL}")
+endforeach()
+set(TABLE "${ROW}\n")
+
+foreach(NAME ${NAMES})
+  pad_right(ROW "${NAME}" ${NAME_WIDTH})
+  foreach(LEVEL ${LEVELS})
+    if(DEFINED NS_${LEVEL}_${NAME})
+      pad(CELL "${NS_${LEVEL}_${NAME}}" 12)
+    else()
+      pad(CELL "-" 12)
+    endif()
+    string(APPEND ROW "${CELL}")
+  endforeach()
+  foreach(LEVEL DEFAULT AUDIT)
+    if(DEFINED NS_${LEVEL}_${NAME} AND DEFINED NS_OFF_${NAME})
+      ratio(CELL "${NS_${LEVEL}_${NAME}}" "${NS_OFF_${NAME}}")
+    else()
+      set(CELL "-")
+    endif()
+    pad(CELL "${CELL}" 12)
+    string(APPEND ROW "${CELL}")
+  endforeach()
+  string(APPEND TABLE "${ROW}\n")
+endforeach()
+
+# Print to stdout rather than through message(), which writes to stderr.
+execute_process(COMMAND ${CMAKE_COMMAND} -E echo_append "${TABLE}")
@@ -0,0 +1,219 @@
+# Copyright 2021 Mapless AI, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Check the generated code of functions in an object file against a spec.
+#
+# Usage:
+#   cmake -DOBJDUMP=<objdump> -DOBJECT=<object file> -DSPEC=<spec file>
+#         -P check_codegen.cmake
+#
+# The spec file contains one check per line, of the form:
+#
+#   <function> <check> [<argument>]
+#
+# Empty lines and lines starting with '#' are ignored. Function names are the
+# (mangled) symbol names; use extern "C" functions to keep the spec readable.
+# Supported checks:
+#
+#   max_instructions <n>  at most <n> instructions (alignment padding excluded)
+#   max_bytes <n>         at most <n> bytes of code, per the symbol table
+#   max_compares <n>      at most <n> compare/test instructions
+#   max_branches <n>      at most <n> conditional branches
+#   no_calls              no direct, indirect, or tail calls
+#   no_symbol <regex>     no call to, or other reference of, a symbol matching
+#                         <regex> (e.g., 'basic_string|ostream')
+#   same_as <function>    the same instructions as <function>, up to branch
+#                         target addresses and the values of constants loaded
+#                         through relocations
+#
+# GCC moves code that is only reached on unlikely paths (e.g., reporting
+# contract violations) into a separate '<function>.cold' part, which is not
+# included in the checks of '<function>'.
+
+foreach(VAR OBJDUMP OBJECT SPEC)
+  if(NOT DEFINED ${VAR})
+    message(FATAL_ERROR "check_codegen: ${VAR} must be defined")
+  endif()
+endforeach()
+
+execute_process(
+  COMMAND ${OBJDUMP} -dr --no-show-raw-insn ${OBJECT}
+  OUTPUT_VARIABLE DISASSEMBLY
+  RESULT_VARIABLE RESULT
+)
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "check_codegen: failed to disassemble ${OBJECT}")
+endif()
+
+execute_process(
+  COMMAND ${OBJDUMP} -t ${OBJECT}
+  OUTPUT_VARIABLE SYMBOLS
+  RESULT_VARIABLE RESULT
+)
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "check_codegen: failed to read the symbols of ${OBJECT}")
+endif()
+
+# Make the output safe to handle as a CMake list of lines.
+foreach(VAR DISASSEMBLY SYMBOLS)
+  string(REPLACE ";" "," ${VAR} "${${VAR}}")
+  string(REPLACE "[" "(" ${VAR} "${${VAR}}")
+  string(REPLACE "]" ")" ${VAR} "${${VAR}}")
+  string(REPLACE "\\" "/" ${VAR} "${${VAR}}")
+endforeach()
+string(REPLACE "\n" ";" LINES "${DISASSEMBLY}")
+string(REPLACE "\n" ";" SYMBOL_LINES "${SYMBOLS}")
+
+# Collect the code size of functions, e.g., from
+# "0000000000000000 g     F .text  000000000000001c codegen_function".
+foreach(LINE IN LISTS SYMBOL_LINES)
+  if(LINE MATCHES "^[0-9a-f]+ .* F [^ \t]+[ \t]+([0-9a-f]+)[ \t]+([^ \t]+)$")
+    math(EXPR BYTES_${CMAKE_MATCH_2} "0x${CMAKE_MATCH_1}")
+  endif()
+endforeach()
+
+# Collect instructions, calls and referenced symbols per function.
+set(PADDING_REGEX "^(nop|xchg +%ax,%ax|data16|cs nop|int3)")
+set(CURRENT "")
+foreach(LINE IN LISTS LINES)
+  if(LINE MATCHES "^[0-9a-f]+ <([^>]+)>:$")
+    set(CURRENT "${CMAKE_MATCH_1}")
+    set(INSNS_${CURRENT} "")
+    set(CALLS_${CURRENT} "")
+    set(SYMBOLS_${CURRENT} "")
+  elseif(CURRENT AND LINE MATCHES "^[ \t]+[0-9a-f]+: (R_[A-Z0-9_]+)[ \t]+(.*)$")
+    if(CMAKE_MATCH_1 MATCHES "PLT32|PLT|GOTPCREL")
+      list(APPEND CALLS_${CURRENT} "${CMAKE_MATCH_2}")
+    endif()
+    list(APPEND SYMBOLS_${CURRENT} "${CMAKE_MATCH_2}")
+  elseif(CURRENT AND LINE MATCHES "^[ \t]+[0-9a-f]+:\t(.*)$")
+    set(INSN "${CMAKE_MATCH_1}")
+    # Calls within the object name their target, e.g., "call 0 <_ZNSt...>".
+    if(INSN MATCHES "^(call|jmp) +[0-9a-f]+ <([^+>]+)>")
+      list(APPEND SYMBOLS_${CURRENT} "${CMAKE_MATCH_2}")
+    endif()
+    # Drop objdump's comments and make branch targets function-relative.
+    string(REGEX REPLACE "[ \t]*#.*$" "" INSN "${INSN}")
+    string(REGEX REPLACE "[0-9a-f]+ <[^+>]*(\\+0x[0-9a-f]+|)>" "<\\1>" INSN
+      "${INSN}")
+    string(STRIP "${INSN}" INSN)
+    if(NOT INSN MATCHES "${PADDING_REGEX}")
+      list(APPEND INSNS_${CURRENT} "${INSN}")
+      if(INSN MATCHES "^(call|jmp +\\*)")
+        list(APPEND CALLS_${CURRENT} "${INSN}")
+      endif()
+    endif()
+  endif()
+endforeach()
+
+# Evaluate the spec.
+file(STRINGS ${SPEC} SPEC_LINES)
+set(FAILURES 0)
+foreach(SPEC_LINE IN LISTS SPEC_LINES)
+  string(STRIP "${SPEC_LINE}" SPEC_LINE)
+  if(SPEC_LINE STREQUAL "" OR SPEC_LINE MATCHES "^#")
+    continue()
+  endif()
+  string(REGEX REPLACE "[ \t]+" ";" ARGS "${SPEC_LINE}")
+  list(GET ARGS 0 FUNCTION)
+  list(GET ARGS 1 CHECK)
+  list(LENGTH ARGS NUM_ARGS)
+  set(ARG "")
+  if(NUM_ARGS GREATER 2)
+    list(GET ARGS 2 ARG)
+  elseif(CHECK MATCHES "^max_|^same_as$|^no_symbol$")
+    message(FATAL_ERROR "${FUNCTION}: check '${CHECK}' requires an argument")
+  endif()
+
+  if(NOT DEFINED INSNS_${FUNCTION})
+    message(SEND_ERROR "${FUNCTION}: function not found in ${OBJECT}")
+    math(EXPR FAILURES "${FAILURES} + 1")
+    continue()
+  endif()
+  set(INSNS ${INSNS_${FUNCTION}})
+
+  if(CHECK STREQUAL "max_instructions")
+    list(LENGTH INSNS COUNT)
+  elseif(CHECK STREQUAL "max_compares")
+    set(COUNT 0)
+    foreach(INSN IN LISTS INSNS)
+      if(INSN MATCHES "^(v?u?comis[sd]|v?cmp[a-z]*|v?p?test[a-z]*) ")
+        math(EXPR COUNT "${COUNT} + 1")
+      endif()
+    endforeach()
+  elseif(CHECK STREQUAL "max_branches")
+    set(COUNT 0)
+    foreach(INSN IN LISTS INSNS)
+      if(INSN MATCHES "^j[a-z]+ " AND NOT INSN MATCHES "^jmp ")
+        math(EXPR COUNT "${COUNT} + 1")
+      endif()
+    endforeach()
+  elseif(CHECK STREQUAL "max_bytes")
+    if(NOT DEFINED BYTES_${FUNCTION})
+      message(SEND_ERROR "${FUNCTION}: size not found in ${OBJECT}")
+      math(EXPR FAILURES "${FAILURES} + 1")
+      continue()
+    endif()
+    set(COUNT ${BYTES_${FUNCTION}})
+  elseif(CHECK STREQUAL "no_calls")
+    list(LENGTH CALLS_${FUNCTION} COUNT)
+    set(ARG 0)
+  elseif(CHECK STREQUAL "no_symbol")
+    set(MATCHES "")
+    foreach(SYMBOL IN LISTS SYMBOLS_${FUNCTION})
+      if(SYMBOL MATCHES "${ARG}")
+        list(APPEND MATCHES "${SYMBOL}")
+      endif()
+    endforeach()
+    if(MATCHES)
+      string(REPLACE ";" "\n    " LISTING "${MATCHES}")
+      message(SEND_ERROR "${FUNCTION}: ${CHECK} ${ARG} failed\n    ${LISTING}")
+      math(EXPR FAILURES "${FAILURES} + 1")
+    else()
+      message(STATUS "${FUNCTION}: ${CHECK} ${ARG} passed")
+    endif()
+    continue()
+  elseif(CHECK STREQUAL "same_as")
+    if(NOT DEFINED INSNS_${ARG})
+      message(SEND_ERROR "${ARG}: function not found in ${OBJECT}")
+      math(EXPR FAILURES "${FAILURES} + 1")
+      continue()
+    endif()
+    if("${INSNS}" STREQUAL "${INSNS_${ARG}}")
+      message(STATUS "${FUNCTION}: ${CHECK} ${ARG} passed")
+    else()
+      string(REPLACE ";" "\n    " LISTING "${INSNS}")
+      string(REPLACE ";" "\n    " EXPECTED "${INSNS_${ARG}}")
+      message(SEND_ERROR "${FUNCTION}: ${CHECK} ${ARG} failed\n    "
+        "${LISTING}\n  expected:\n    ${EXPECTED}")
+      math(EXPR FAILURES "${FAILURES} + 1")
+    endif()
+    continue()
+  else()
+    message(FATAL_ERROR "${FUNCTION}: unknown check '${CHECK}'")
+  endif()
+
+  if(COUNT GREATER ARG)
+    string(REPLACE ";" "\n    " LISTING "${INSNS}")
+    message(SEND_ERROR
+      "${FUNCTION}: ${CHECK} ${ARG} failed (found ${COUNT})\n    ${LISTING}")
+    math(EXPR FAILURES "${FAILURES} + 1")
+  else()
+    message(STATUS "${FUNCTION}: ${CHECK} ${ARG} passed (found ${COUNT})")
+  endif()
+endforeach()
+
+if(FAILURES GREATER 0)
+  message(FATAL_ERROR "check_codegen: ${FAILURES} check(s) failed")
+endif()
@@ -0,0 +1,79 @@
+# Copyright 2021 Mapless AI, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Check that a binary has the static tracepoints (USDT probes) of the contract
+# checks, in its ELF notes (see include/contracts_lite/probes.hpp).
+#
+# Usage:
+#   cmake -DREADELF=<readelf> -DBINARY=<binary> -DPROBES=<name>[,<name>...]
+#         -P check_probes.cmake
+#
+# Each probe must be present in the 'contracts_lite' provider, with two
+# arguments, and its location must not be zero.
+
+foreach(VAR READELF BINARY PROBES)
+  if(NOT DEFINED ${VAR})
+    message(FATAL_ERROR "check_probes: ${VAR} must be defined")
+  endif()
+endforeach()
+
+execute_process(
+  COMMAND ${READELF} -n ${BINARY}
+  OUTPUT_VARIABLE NOTES
+  RESULT_VARIABLE RESULT
+)
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "check_probes: failed to read the notes of ${BINARY}")
+endif()
+
+# One entry per probe, from "Provider:" to "Arguments:".
+string(REPLACE ";" "\;" NOTES "${NOTES}")
+string(REPLACE "\n" ";" LINES "${NOTES}")
+set(FAILURES "")
+string(REPLACE "," ";" PROBES "${PROBES}")
+foreach(PROBE ${PROBES})
+  set(FOUND FALSE)
+  set(PROVIDER "")
+  set(NAME "")
+  set(LOCATION "")
+  foreach(LINE ${LINES})
+    if(LINE MATCHES "Provider: *([^ ]+)")
+      set(PROVIDER ${CMAKE_MATCH_1})
+    elseif(LINE MATCHES "Name: *([^ ]+)")
+      set(NAME ${CMAKE_MATCH_1})
+    elseif(LINE MATCHES "Location: *(0x[0-9a-f]+)")
+      set(LOCATION ${CMAKE_MATCH_1})
+    elseif(LINE MATCHES "Arguments: *(.*)$")
+      set(ARGUMENTS "${CMAKE_MATCH_1}")
+      if(PROVIDER STREQUAL "contracts_lite" AND NAME STREQUAL PROBE)
+        set(FOUND TRUE)
+        if(NOT ARGUMENTS MATCHES "^[^ ]+@[^ ]+ [^ ]+@[^ ]+$")
+          list(APPEND FAILURES
+            "${PROBE}: expected two arguments, found '${ARGUMENTS}'")
+        endif()
+        if(LOCATION MATCHES "^0x0+$")
+          list(APPEND FAILURES "${PROBE}: zero location")
+        endif()
+      endif()
+    endif()
+  endforeach()
+  if(NOT FOUND)
+    list(APPEND FAILURES "contracts_lite:${PROBE}: not found")
+  endif()
+endforeach()
+
+if(FAILURES)
+  string(REPLACE ";" "\n  " FAILURES "${FAILURES}")
+  message(FATAL_ERROR "check_probes: ${BINARY}:\n  ${FAILURES}")
+endif()
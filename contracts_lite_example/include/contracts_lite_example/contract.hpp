@@ -19,7 +19,7 @@
 #include <array>
 #include <type_traits>
 
-#include "contracts_lite/operators.hpp"
+#include "contracts_lite/return_status.hpp"
 
 /**
  * @brief This include is the violation handler.
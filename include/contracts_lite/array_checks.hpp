@@ -0,0 +1,275 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines checks on small fixed-size arrays of reals.
+
+#ifndef CONTRACTS__ARRAY_CHECKS_HPP_
+#define CONTRACTS__ARRAY_CHECKS_HPP_
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+namespace array_checks {
+
+/**
+ * @brief Dot product of two arrays of length 'N'.
+ *
+ * @note The loop has a fixed trip count and no branches, so the compiler fully
+ * unrolls it and may vectorize it.
+ */
+template <std::size_t N, typename T>
+constexpr T dot(const T* a, const T* b) {
+  T sum = static_cast<T>(0);
+  for (std::size_t i = 0; i < N; ++i) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+/** @brief Squared Euclidean norm of an array of length 'N'. */
+template <std::size_t N, typename T>
+constexpr T squared_norm(const T* a) {
+  return dot<N>(a, a);
+}
+
+/**
+ * @brief Scale an array of length 'N' with a squared norm near one closer to
+ * unit norm.
+ *
+ * This is one Newton step for 1 / sqrt(n2), so it avoids the square root and
+ * the division: if the squared norm is 1 + e, the result has a squared norm of
+ * 1 + O(e^2). It is meant for restoring unit norm after operations on unit
+ * arrays that only accumulate rounding error.
+ */
+template <std::size_t N, typename T>
+void renormalize(T* a) {
+  const T scale =
+      (static_cast<T>(3) - squared_norm<N>(a)) * static_cast<T>(0.5);
+  for (std::size_t i = 0; i < N; ++i) {
+    a[i] *= scale;
+  }
+}
+
+/**
+ * @brief Whether |value - target| <= tol.
+ *
+ * @note This is false if 'value' is NaN.
+ */
+template <typename T>
+constexpr bool is_near(T value, T target, T tol) {
+  return ((value - target) <= tol) & ((target - value) <= tol);
+}
+
+/** @brief Check whether |value - target| <= tol. */
+template <typename T>
+ReturnStatus near(T value, T target, T tol) {
+  auto comment = CONTRACT_COMMENT(
+      "", gcc_7x_to_string_fix(value) + " must be within " +
+              gcc_7x_to_string_fix(tol) + " of " +
+              gcc_7x_to_string_fix(target));
+  return ReturnStatus(std::move(comment), is_near(value, target, tol));
+}
+
+/**
+ * @brief Whether the rows of the row-major N x N matrix 'm' are orthonormal,
+ * i.e., |dot(r_i, r_j) - delta_ij| <= tol for all pairs of rows.
+ */
+template <std::size_t N, typename T>
+constexpr bool is_near_orthonormal(const T* m, T tol) {
+  bool valid = true;
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = i; j < N; ++j) {
+      const auto target = static_cast<T>((i == j) ? 1 : 0);
+      valid &= is_near(dot<N>(m + i * N, m + j * N), target, tol);
+    }
+  }
+  return valid;
+}
+
+/**
+ * @brief Check that the rows of the row-major N x N matrix 'm' are
+ * orthonormal (see is_near_orthonormal).
+ */
+template <std::size_t N, typename T>
+ReturnStatus near_orthonormal(const T* m, T tol) {
+  auto comment = CONTRACT_COMMENT(
+      "", "rows of the " + std::to_string(N) + "x" + std::to_string(N) +
+              " matrix must be orthonormal within " +
+              gcc_7x_to_string_fix(tol));
+  return ReturnStatus(std::move(comment), is_near_orthonormal<N>(m, tol));
+}
+
+/**
+ * @brief Whether each of 'count' consecutive arrays of length 'N' in 'data'
+ * has a squared norm within 'tol' of one.
+ *
+ * @note All elements are evaluated and the results are combined without
+ * short-circuiting, which keeps the loop free of data-dependent branches.
+ */
+template <std::size_t N, typename T>
+bool all_near_unit_norm(const T* data, std::size_t count, T tol) {
+  bool valid = true;
+  for (std::size_t i = 0; i < count; ++i) {
+    valid &= is_near(squared_norm<N>(data + i * N), static_cast<T>(1), tol);
+  }
+  return valid;
+}
+
+/**
+ * @brief Get the index of the first array of length 'N' in 'data' whose
+ * squared norm is not within 'tol' of one, or 'count' if there is none.
+ */
+template <std::size_t N, typename T>
+std::size_t find_not_near_unit_norm(const T* data, std::size_t count, T tol) {
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!is_near(squared_norm<N>(data + i * N), static_cast<T>(1), tol)) {
+      return i;
+    }
+  }
+  return count;
+}
+
+/**
+ * @brief Check that each of 'count' consecutive arrays of length 'N' in 'data'
+ * has a squared norm within 'tol' of one.
+ *
+ * @note The offending index is only searched for when generating the AUDIT
+ * comment of a failed check.
+ */
+template <std::size_t N, typename T>
+ReturnStatus near_unit_norm(const T* data, std::size_t count, T tol) {
+  const bool valid = all_near_unit_norm<N>(data, count, tol);
+  auto comment = CONTRACT_COMMENT(
+      "", valid ? std::string()
+                : ("element " +
+                   std::to_string(
+                       find_not_near_unit_norm<N>(data, count, tol)) +
+                   " of " + std::to_string(count) +
+                   " must have a squared norm within " +
+                   gcc_7x_to_string_fix(tol) + " of 1"));
+  return ReturnStatus(std::move(comment), valid);
+}
+
+/**
+ * @brief Whether the 'n' elements of 'data' are strictly increasing.
+ *
+ * @note All adjacent pairs are compared and the results are combined without
+ * short-circuiting, so the loop vectorizes for arithmetic types. For floating
+ * point types, NaN elements make the sequence not strictly increasing.
+ */
+template <typename T>
+bool is_strictly_increasing(const T* data, std::size_t n) {
+  bool valid = true;
+  for (std::size_t i = 1; i < n; ++i) {
+    valid &= (data[i - 1] < data[i]);
+  }
+  return valid;
+}
+
+/**
+ * @brief Get the index of the first element of 'data' that is not greater than
+ * its predecessor, or 'n' if there is none.
+ */
+template <typename T>
+std::size_t find_not_increasing(const T* data, std::size_t n) {
+  for (std::size_t i = 1; i < n; ++i) {
+    if (!(data[i - 1] < data[i])) {
+      return i;
+    }
+  }
+  return n;
+}
+
+/**
+ * @brief Check that the 'n' elements of 'data' are strictly increasing.
+ *
+ * @note The offending index is only searched for when generating the AUDIT
+ * comment of a failed check.
+ */
+template <typename T>
+ReturnStatus strictly_increasing(const T* data, std::size_t n) {
+  const bool valid = is_strictly_increasing(data, n);
+  auto comment = CONTRACT_COMMENT(
+      "", valid ? std::string()
+                : ("element " + std::to_string(find_not_increasing(data, n)) +
+                   " of " + std::to_string(n) +
+                   " must be greater than its predecessor"));
+  return ReturnStatus(std::move(comment), valid);
+}
+
+/** @brief Result of sum_and_range. */
+template <typename T>
+struct SumAndRange {
+  T sum;          // compensated sum of the elements
+  bool in_range;  // whether all elements are in [min, max]
+};
+
+/**
+ * @brief Sum the 'n' elements of 'data' and check that each is in [min, max],
+ * in a single pass.
+ *
+ * The sum is accumulated in independent lanes, each with Kahan compensation,
+ * so the error is bounded by a few ulps regardless of 'n' and the lanes map
+ * onto SIMD registers. The range check is combined without short-circuiting
+ * to keep the loop free of data-dependent branches. NaN elements are out of
+ * range.
+ *
+ * @note Compensated summation relies on strict floating point semantics, so it
+ * degrades to plain summation under -ffast-math or -fassociative-math.
+ */
+template <typename T>
+SumAndRange<T> sum_and_range(const T* data, std::size_t n, T min, T max) {
+  constexpr std::size_t kLanes = 4;
+  T sum[kLanes] = {};
+  T compensation[kLanes] = {};
+  bool in_range = true;
+  const auto accumulate = [&](std::size_t lane, T value) {
+    in_range &= (value >= min) & (value <= max);
+    const T y = value - compensation[lane];
+    const T t = sum[lane] + y;
+    compensation[lane] = (t - sum[lane]) - y;
+    sum[lane] = t;
+  };
+  std::size_t i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      accumulate(lane, data[i + lane]);
+    }
+  }
+  for (std::size_t lane = 0; i < n; ++i, ++lane) {
+    accumulate(lane, data[i]);
+  }
+
+  // Combine the lanes, carrying their compensations along.
+  T total = static_cast<T>(0);
+  T total_compensation = static_cast<T>(0);
+  for (std::size_t lane = 0; lane < kLanes; ++lane) {
+    const T y = (sum[lane] - compensation[lane]) - total_compensation;
+    const T t = total + y;
+    total_compensation = (t - total) - y;
+    total = t;
+  }
+  return SumAndRange<T>{total, in_range};
+}
+
+}  // namespace array_checks
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__ARRAY_CHECKS_HPP_
@@ -0,0 +1,50 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTRACTS__ASSUME_VALID_HPP_
+#define CONTRACTS__ASSUME_VALID_HPP_
+
+/**
+ * @brief Declares namespace-scope constants 'inline' where the language has
+ * inline variables (C++17), so that there is a single definition of each.
+ */
+#ifdef __cpp_inline_variables
+#define CONTRACT_INLINE_VARIABLE inline
+#else
+#define CONTRACT_INLINE_VARIABLE
+#endif
+
+namespace contracts_lite {
+
+/**
+ * @brief Tag type selecting the trusted constructor of a contract type.
+ *
+ * Contract types provide a constructor overload taking this tag for use when
+ * the value is already known to satisfy the type invariant, e.g., because it
+ * was computed from another validated object. The invariant check in these
+ * constructors is enforced only at the AUDIT build level.
+ *
+ * @note Passing a value that does not satisfy the invariant is a contract
+ * violation by the caller that goes undetected outside of AUDIT builds.
+ */
+struct assume_valid_t {
+  explicit constexpr assume_valid_t() = default;
+};
+
+/** @brief Tag object for selecting the trusted constructor. */
+CONTRACT_INLINE_VARIABLE constexpr assume_valid_t assume_valid{};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__ASSUME_VALID_HPP_
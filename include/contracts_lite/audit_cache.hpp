@@ -0,0 +1,212 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines a cache of passed audit checks.
+
+#ifndef CONTRACTS__AUDIT_CACHE_HPP_
+#define CONTRACTS__AUDIT_CACHE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "contracts_lite/enforcement.hpp"
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Index of the calling thread, in the order in which threads first
+ * call this function.
+ * @note INTERNAL USE ONLY
+ */
+inline std::size_t audit_cache_thread_index() {
+  static std::atomic<std::size_t> next(0);
+  thread_local const std::size_t index =
+      next.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+/** @brief Hit and miss counts of an audit cache. */
+struct AuditCacheStats {
+  std::uint64_t hits;
+  std::uint64_t misses;
+
+  /** @brief Fraction of lookups that were hits, or zero if there were none. */
+  double hit_rate() const {
+    const auto lookups = hits + misses;
+    return (lookups == 0) ? 0.0
+                          : static_cast<double>(hits) /
+                                static_cast<double>(lookups);
+  }
+};
+
+/**
+ * @brief Bounded cache of audit checks that passed, keyed on an object
+ * identity, a version of that object and the enforcing call site.
+ *
+ * Each of the 'Slots' slots is a single atomic 64-bit hash of its key, so
+ * lookups and insertions are lock-free and wait-free, and a colliding
+ * insertion evicts the previous key. Only passed checks are inserted: a
+ * failing check is re-evaluated, and reported, on every call.
+ *
+ * @note A lookup can only return a wrong hit if two different keys hash to
+ * the same 64-bit value.
+ *
+ * @note Each lookup counts a hit or miss in the counters of one of 'Shards'
+ * shards, chosen by thread, which stats() sums. Up to 'Shards' threads thus
+ * count their lookups on cache lines of their own, and only read the slots.
+ *
+ * @note The version must change whenever the checked object changes. Since
+ * the identity is the object address, versions should be unique across
+ * objects that may reuse an address, e.g., drawn from a global counter.
+ */
+template <std::size_t Slots = 4096, std::size_t Shards = 16>
+class AuditCache {
+  static_assert(Slots > 0 && (Slots & (Slots - 1)) == 0,
+                "Audit cache size must be a power of two.");
+  static_assert(Shards > 0, "Audit cache must have a counter shard.");
+
+ public:
+  AuditCache() {
+    clear();
+    reset_stats();
+  }
+  AuditCache(const AuditCache&) = delete;
+  AuditCache& operator=(const AuditCache&) = delete;
+
+  /**
+   * @brief Key of the check at line 'line' of 'file' for version 'version' of
+   * 'object'. Zero is reserved for empty slots.
+   */
+  static std::uint64_t key(const void* object, std::uint64_t version,
+                           const char* file, std::uint64_t line) {
+    auto h = mix(reinterpret_cast<std::uintptr_t>(file) + line);
+    h = mix(h ^ version);
+    h = mix(h ^ reinterpret_cast<std::uintptr_t>(object));
+    return (h == 0) ? 1 : h;
+  }
+
+  /** @brief Whether a check with key 'key' passed, counting a hit or miss. */
+  bool contains(std::uint64_t key) const {
+    const bool hit = (slot(key).load(std::memory_order_relaxed) == key);
+    auto& counters = shards_[audit_cache_thread_index() % Shards];
+    (hit ? counters.hits : counters.misses)
+        .fetch_add(1, std::memory_order_relaxed);
+    return hit;
+  }
+
+  /** @brief Record that the check with key 'key' passed. */
+  void insert(std::uint64_t key) {
+    slot(key).store(key, std::memory_order_relaxed);
+  }
+
+  /** @brief Insert 'key' if 'status' passed, and return 'status'. */
+  ReturnStatus insert_if_passed(std::uint64_t key, ReturnStatus status) {
+    if (status.status) {
+      insert(key);
+    }
+    return status;
+  }
+
+  /** @brief Remove all keys, e.g., after objects were modified in place. */
+  void clear() {
+    for (auto& s : slots_) {
+      s.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  static constexpr std::size_t size() { return Slots; }
+
+  AuditCacheStats stats() const {
+    AuditCacheStats total{0, 0};
+    for (const auto& counters : shards_) {
+      total.hits += counters.hits.load(std::memory_order_relaxed);
+      total.misses += counters.misses.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  void reset_stats() {
+    for (auto& counters : shards_) {
+      counters.hits.store(0, std::memory_order_relaxed);
+      counters.misses.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  /** @brief Finalizer of splitmix64, a bijection with good avalanche. */
+  static std::uint64_t mix(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  std::atomic<std::uint64_t>& slot(std::uint64_t key) {
+    return slots_[key & (Slots - 1)];
+  }
+  const std::atomic<std::uint64_t>& slot(std::uint64_t key) const {
+    return slots_[key & (Slots - 1)];
+  }
+
+  /** @brief Counters of a shard, on a cache line of their own. */
+  struct alignas(64) Counters {
+    std::atomic<std::uint64_t> hits;
+    std::atomic<std::uint64_t> misses;
+  };
+
+  std::array<std::atomic<std::uint64_t>, Slots> slots_;
+  mutable std::array<Counters, Shards> shards_;
+};
+
+/** @brief Audit cache used by AUDIT_ENFORCE_CACHED. */
+inline AuditCache<>& default_audit_cache() {
+  static AuditCache<> cache;
+  return cache;
+}
+
+}  // namespace contracts_lite
+
+/**
+ * @brief Enforcement macros that skip an audit check which already passed for
+ * the same version of 'object' at the same call site (see AuditCache).
+ *
+ * They are meant for expensive checks that are pure functions of 'object',
+ * e.g., of a large immutable table. Like AUDIT_ENFORCE, they are only enforced
+ * at the AUDIT build level, and a check that is not skipped is enforced as by
+ * AUDIT_ENFORCE.
+ */
+#ifdef CONTRACT_BUILD_LEVEL_AUDIT
+#define AUDIT_ENFORCE_CACHED_IN(cache, object, version, contract_check) \
+  {                                                                     \
+    const auto contracts_lite_audit_key = (cache).key(                  \
+        std::addressof(object), (version), __FILE__, __LINE__);         \
+    if (!(cache).contains(contracts_lite_audit_key)) {                  \
+      ENFORCE_CONTRACT((cache).insert_if_passed(                        \
+          contracts_lite_audit_key, contract_check));                   \
+    }                                                                   \
+  }
+#else
+#define AUDIT_ENFORCE_CACHED_IN(cache, object, version, contract_check)
+#endif
+
+#define AUDIT_ENFORCE_CACHED(object, version, contract_check)              \
+  AUDIT_ENFORCE_CACHED_IN(::contracts_lite::default_audit_cache(), object, \
+                          version, contract_check)
+
+#endif  // CONTRACTS__AUDIT_CACHE_HPP_
@@ -0,0 +1,197 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines batched enforcement of element-wise checks.
+
+#ifndef CONTRACTS__BATCH_ENFORCEMENT_HPP_
+#define CONTRACTS__BATCH_ENFORCEMENT_HPP_
+
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "contracts_lite/enforcement.hpp"
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Number of exceptions in flight on the calling thread (before C++17,
+ * one if there is any).
+ * @note INTERNAL USE ONLY
+ */
+inline int uncaught_exception_count() noexcept {
+#if defined(__cpp_lib_uncaught_exceptions)
+  return std::uncaught_exceptions();
+#else
+  return std::uncaught_exception() ? 1 : 0;
+#endif
+}
+
+/**
+ * @brief Collector of the results of element-wise checks in a scope, which
+ * enforces them all at once when it is destroyed (see DEFAULT_ENFORCE_BATCH).
+ *
+ * expect() only ORs a failure bit into an unsigned mask and counts the call:
+ * no branch and no ReturnStatus per element, so a loop of plain predicates
+ * (using '&' rather than '&&') vectorizes at -O3. The destructor tests the
+ * mask once. Only if a check failed, 'check' is called with the indices 0, 1,
+ * ... of the calls to expect() until it returns a failed ReturnStatus, and
+ * 'report' is called with that ReturnStatus to handle the violation.
+ *
+ * @pre The i-th call to expect() is passed false if and only if check(i)
+ * fails. Otherwise the reported comment may not match the failing element.
+ *
+ * @note Violations are not reported while an exception thrown since the batch
+ * was created is in flight, e.g., when the scope is left by an exception,
+ * since the handler may throw (with continuation). A batch created while
+ * another exception is in flight, e.g., in a destructor during unwinding,
+ * still reports. Before C++17, an exception thrown in the scope of such a
+ * batch cannot be told apart from the one already in flight, so it does not
+ * stop the report.
+ */
+template <typename Check, typename Report>
+class CheckBatch {
+ public:
+  CheckBatch(Check check, Report report)
+      : check_(std::move(check)),
+        report_(std::move(report)),
+        uncaught_exceptions_(uncaught_exception_count()) {}
+
+  CheckBatch(CheckBatch&& other)
+      : check_(std::move(other.check_)),
+        report_(std::move(other.report_)),
+        uncaught_exceptions_(other.uncaught_exceptions_),
+        failures_(other.failures_),
+        count_(other.count_) {
+    other.failures_ = 0u;
+  }
+
+  CheckBatch(const CheckBatch&) = delete;
+  CheckBatch& operator=(const CheckBatch&) = delete;
+  CheckBatch& operator=(CheckBatch&&) = delete;
+
+  /** @brief Enforces the checks collected so far (see CheckBatch). */
+  ~CheckBatch() noexcept(false) {
+    if (failures_ != 0u) {
+      report_first_failure();
+    }
+  }
+
+  /** @brief Collect the result of the next check. */
+  void expect(bool passed) {
+    failures_ |= static_cast<unsigned>(!passed);
+    ++count_;
+  }
+
+  /** @brief Whether all the checks collected so far passed. */
+  bool passed() const { return failures_ == 0u; }
+
+  /** @brief Number of checks collected so far. */
+  std::size_t size() const { return count_; }
+
+ private:
+  CONTRACT_COLD_PATH void report_first_failure() {
+    if (uncaught_exception_count() > uncaught_exceptions_) {
+      return;
+    }
+    for (std::size_t i = 0; i < count_; ++i) {
+      ReturnStatus status = check_(i);
+      if (!status.status) {
+        report_(std::move(status));
+        return;
+      }
+    }
+    report_(ReturnStatus(
+        std::string("A batched check failed, but no check failed when "
+                    "evaluated again."),
+        false));
+  }
+
+  Check check_;
+  Report report_;
+  int uncaught_exceptions_;
+  unsigned failures_ = 0u;
+  std::size_t count_ = 0u;
+};
+
+template <typename Check, typename Report>
+CheckBatch<Check, Report> make_check_batch(Check check, Report report) {
+  return CheckBatch<Check, Report>(std::move(check), std::move(report));
+}
+
+/** @brief Stand-in for CheckBatch at build levels that do not enforce it. */
+struct NoCheckBatch {
+  void expect(bool) {}
+  bool passed() const { return true; }
+  std::size_t size() const { return 0u; }
+};
+
+}  // namespace contracts_lite
+
+/**
+ * @brief Declares a CheckBatch named 'batch' that enforces its checks at the
+ * end of the enclosing scope. The remaining arguments are a callable from the
+ * index of a check to its ReturnStatus, which gives the comment of the first
+ * failure. They may contain commas, e.g., in a lambda capture list.
+ * @note The violation is reported with the file and line of this macro, and
+ * the name of the enclosing function.
+ * @note INTERNAL USE ONLY
+ */
+#define CONTRACT_CHECK_BATCH(batch, ...)                                  \
+  auto batch = ::contracts_lite::make_check_batch(                        \
+      __VA_ARGS__,                                                        \
+      [contract_function = __func__](::contracts_lite::ReturnStatus check) { \
+        CONTRACT_PROBE(violation, CONTRACT_PROBE_SITE,                    \
+                       check.comment.c_str());                            \
+        CONTRACT_VIOLATION_HANDLER(                                       \
+            CONTRACT_VIOLATION_IN(check.comment, contract_function));     \
+      })
+
+/**
+ * @brief Batched enforcement macros, for element-wise checks in loops, e.g.,
+ *
+ *   DEFAULT_ENFORCE_BATCH(batch, [&](std::size_t i) {
+ *     return UnitReal<float>::check(x[i]);
+ *   });
+ *   for (std::size_t i = 0; i < n; ++i) {
+ *     batch.expect(UnitReal<float>::is_valid(x[i]));
+ *     ...
+ *   }
+ *
+ * At build levels that do not enforce them, 'batch' does nothing and the
+ * check is never called. The arguments of expect() are still evaluated, so
+ * they should be predicates without side effects, which the compiler then
+ * removes. The comment and function reported for a failure
+ * are those of the immediate check of the failing element, and the line is
+ * that of the batch.
+ */
+#ifdef CONTRACT_BUILD_LEVEL_OFF
+#define AUDIT_ENFORCE_BATCH(batch, ...) ::contracts_lite::NoCheckBatch batch
+#define DEFAULT_ENFORCE_BATCH(batch, ...) ::contracts_lite::NoCheckBatch batch
+#elif defined(CONTRACT_BUILD_LEVEL_AUDIT)
+#define AUDIT_ENFORCE_BATCH(batch, ...) \
+  CONTRACT_CHECK_BATCH(batch, __VA_ARGS__)
+#define DEFAULT_ENFORCE_BATCH(batch, ...) \
+  CONTRACT_CHECK_BATCH(batch, __VA_ARGS__)
+#else
+#define AUDIT_ENFORCE_BATCH(batch, ...) ::contracts_lite::NoCheckBatch batch
+#define DEFAULT_ENFORCE_BATCH(batch, ...) \
+  CONTRACT_CHECK_BATCH(batch, __VA_ARGS__)
+#endif
+
+#endif  // CONTRACTS__BATCH_ENFORCEMENT_HPP_
@@ -0,0 +1,70 @@
+// Copyright 2020 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file contracts_lite.hpp
+ * All of the checks and contract types, except for the opt-in stream
+ * operators (see ostream.hpp). This is the header that the precompiled header
+ * target is built from.
+ *
+ * The violation handler is the one defined before this header is included,
+ * or in the header named by CONTRACT_VIOLATION_HANDLER_HEADER, e.g.,
+ * -DCONTRACT_VIOLATION_HANDLER_HEADER='"my_handler.hpp"', and otherwise the
+ * simple violation handler.
+ */
+
+#ifndef CONTRACTS__CONTRACTS_LITE_HPP_
+#define CONTRACTS__CONTRACTS_LITE_HPP_
+
+#if defined(CONTRACT_VIOLATION_HANDLER_HEADER)
+#include CONTRACT_VIOLATION_HANDLER_HEADER
+#elif !defined(CONTRACT_VIOLATION_HANDLER)
+#include "contracts_lite/simple_violation_handler.hpp"
+#endif
+
+#include "contracts_lite/array_checks.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/audit_cache.hpp"
+#include "contracts_lite/batch_enforcement.hpp"
+#include "contracts_lite/deferred_audit.hpp"
+#include "contracts_lite/enforcement.hpp"
+#include "contracts_lite/float16.hpp"
+#include "contracts_lite/float_bits.hpp"
+#include "contracts_lite/niche_traits.hpp"
+#include "contracts_lite/optional.hpp"
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/return_status.hpp"
+#include "contracts_lite/types/acute_degree.hpp"
+#include "contracts_lite/types/acute_radian.hpp"
+#include "contracts_lite/types/acute_trig.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+#include "contracts_lite/types/bounded_vector.hpp"
+#include "contracts_lite/types/covariance_matrix.hpp"
+#include "contracts_lite/types/math.hpp"
+#include "contracts_lite/types/monotonic_sequence.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/nonzero_real.hpp"
+#include "contracts_lite/types/probability_simplex.hpp"
+#include "contracts_lite/types/quantity.hpp"
+#include "contracts_lite/types/ranged.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/rotation_matrix3.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/strictly_positive_odd_integer.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "contracts_lite/types/unit_quaternion.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "contracts_lite/types/unit_vector3.hpp"
+
+#endif  // CONTRACTS__CONTRACTS_LITE_HPP_
@@ -0,0 +1,280 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines a worker pool for deferred audit checks.
+
+#ifndef CONTRACTS__DEFERRED_AUDIT_HPP_
+#define CONTRACTS__DEFERRED_AUDIT_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "contracts_lite/enforcement.hpp"
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+
+/** @brief What a deferred audit pool does with a check if its queue is full. */
+enum class Backpressure {
+  drop,       ///< Discard the check.
+  block,      ///< Wait for room in the queue.
+  run_inline  ///< Evaluate the check on the calling thread.
+};
+
+/** @brief Counts and queue depths of a deferred audit pool. */
+struct DeferredAuditStats {
+  std::uint64_t enqueued;    ///< Checks queued for the workers.
+  std::uint64_t completed;   ///< Checks evaluated, by the workers or inline.
+  std::uint64_t dropped;     ///< Checks discarded by Backpressure::drop.
+  std::uint64_t run_inline;  ///< Checks run by Backpressure::run_inline.
+  std::uint64_t violations;  ///< Checks that failed.
+  std::size_t depth;         ///< Checks in the queue.
+  std::size_t max_depth;     ///< Largest depth since construction.
+};
+
+/**
+ * @brief Bounded pool of worker threads that evaluate audit checks off the
+ * calling thread (see AUDIT_ENFORCE_DEFERRED).
+ *
+ * A check is queued with a snapshot of its inputs, which the pool owns, so the
+ * caller may change or destroy the inputs as soon as submit() returns. When
+ * the queue is full, the backpressure policy decides what happens.
+ *
+ * A failed check calls the violation handler on the worker. Without
+ * continuation, this terminates as for checks on the calling thread. With
+ * continuation, the first exception thrown by the handler is kept, and
+ * rethrown by drain().
+ *
+ * @note The destructor evaluates the queued checks before joining the
+ * workers. A pool without workers evaluates the checks that it does not drop
+ * on the calling thread.
+ */
+class DeferredAuditPool {
+ public:
+  explicit DeferredAuditPool(std::size_t threads = 1,
+                             std::size_t capacity = 1024,
+                             Backpressure policy = Backpressure::block)
+      : capacity_(capacity), policy_(policy) {
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers_.emplace_back([this]() { work(); });
+    }
+  }
+
+  DeferredAuditPool(const DeferredAuditPool&) = delete;
+  DeferredAuditPool& operator=(const DeferredAuditPool&) = delete;
+
+  ~DeferredAuditPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    not_empty_.notify_all();
+    for (auto& w : workers_) {
+      w.join();
+    }
+  }
+
+  /**
+   * @brief Queues 'check' with a copy of 'snapshot', or runs or drops it as
+   * the backpressure policy says if the queue is full.
+   *
+   * 'check' is called with the snapshot as a const reference, and returns
+   * whether the check passed; it reports violations itself.
+   */
+  template <typename Snapshot, typename Check>
+  void submit(Snapshot&& snapshot, Check check) {
+    using S = typename std::decay<Snapshot>::type;
+    std::unique_ptr<Task> task(new TaskFor<S, Check>(
+        std::forward<Snapshot>(snapshot), std::move(check)));
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.size() >= capacity_ || workers_.empty()) {
+      if (policy_ == Backpressure::drop) {
+        ++stats_.dropped;
+        return;
+      }
+      if (policy_ == Backpressure::run_inline || workers_.empty()) {
+        ++stats_.run_inline;
+        lock.unlock();
+        bool passed = false;
+        try {
+          passed = task->run();
+        } catch (...) {
+          lock.lock();
+          ++stats_.completed;
+          ++stats_.violations;
+          throw;
+        }
+        lock.lock();
+        ++stats_.completed;
+        stats_.violations += passed ? 0 : 1;
+        return;
+      }
+      not_full_.wait(lock, [this]() { return queue_.size() < capacity_; });
+    }
+    queue_.push_back(std::move(task));
+    ++stats_.enqueued;
+    stats_.depth = queue_.size();
+    stats_.max_depth = std::max(stats_.max_depth, stats_.depth);
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  /**
+   * @brief Waits until all queued checks have been evaluated, and rethrows
+   * the first exception thrown by the violation handler on a worker, if any.
+   */
+  void drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return queue_.empty() && active_ == 0; });
+    if (exception_) {
+      std::exception_ptr e = exception_;
+      exception_ = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+  DeferredAuditStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  std::size_t capacity() const { return capacity_; }
+  Backpressure policy() const { return policy_; }
+
+ private:
+  /** @brief Type-erased check with its snapshot. */
+  struct Task {
+    virtual ~Task() = default;
+    virtual bool run() = 0;
+  };
+
+  template <typename S, typename Check>
+  struct TaskFor : Task {
+    template <typename T>
+    TaskFor(T&& s, Check c)
+        : snapshot(std::forward<T>(s)), check(std::move(c)) {}
+    bool run() override { return check(static_cast<const S&>(snapshot)); }
+    S snapshot;
+    Check check;
+  };
+
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      not_empty_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      std::unique_ptr<Task> task = std::move(queue_.front());
+      queue_.pop_front();
+      stats_.depth = queue_.size();
+      ++active_;
+      lock.unlock();
+      not_full_.notify_one();
+
+      bool passed = false;
+      std::exception_ptr e;
+      try {
+        passed = task->run();
+      } catch (...) {
+        e = std::current_exception();
+      }
+      task.reset();
+
+      lock.lock();
+      --active_;
+      ++stats_.completed;
+      stats_.violations += passed ? 0 : 1;
+      if (e && !exception_) {
+        exception_ = e;
+      }
+      if (queue_.empty() && active_ == 0) {
+        idle_.notify_all();
+      }
+    }
+  }
+
+  const std::size_t capacity_;
+  const Backpressure policy_;
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::condition_variable idle_;
+  std::deque<std::unique_ptr<Task>> queue_;
+  std::size_t active_ = 0;
+  bool stopping_ = false;
+  std::exception_ptr exception_;
+  DeferredAuditStats stats_{};
+  std::vector<std::thread> workers_;
+};
+
+/** @brief Deferred audit pool used by AUDIT_ENFORCE_DEFERRED. */
+inline DeferredAuditPool& default_deferred_audit_pool() {
+  static DeferredAuditPool pool;
+  return pool;
+}
+
+}  // namespace contracts_lite
+
+/**
+ * @brief Enforcement macros that evaluate an audit check on a worker of
+ * 'pool' (see DeferredAuditPool), for expensive checks whose result the
+ * caller does not need to wait for.
+ *
+ * 'snapshot' is an expression whose value is copied, or moved, into the pool:
+ * either the inputs of the check, or a copy of them made by the caller, e.g.,
+ * 'plan.clone()'. 'contract_check' is called on the worker, with the snapshot
+ * as a const reference, and returns a ReturnStatus. A violation is reported
+ * with the file, line and function of the enforcement site. Like
+ * AUDIT_ENFORCE, they are only enforced at the AUDIT build level, and
+ * otherwise neither expression is evaluated.
+ */
+#ifdef CONTRACT_BUILD_LEVEL_AUDIT
+#define AUDIT_ENFORCE_DEFERRED_IN(pool, snapshot, contract_check)     \
+  {                                                                   \
+    const char* const contract_function = __func__;                   \
+    (pool).submit(snapshot, [contract_function,                       \
+                             contract_deferred = (contract_check)](   \
+                                const auto& contract_snapshot) {      \
+      ::contracts_lite::ReturnStatus check =                          \
+          contract_deferred(contract_snapshot);                       \
+      if (!check.status) {                                            \
+        CONTRACT_VIOLATION_HANDLER(                                   \
+            CONTRACT_VIOLATION_IN(check.comment, contract_function)); \
+      }                                                               \
+      return check.status;                                            \
+    });                                                               \
+  }
+#else
+#define AUDIT_ENFORCE_DEFERRED_IN(pool, snapshot, contract_check)
+#endif
+
+#define AUDIT_ENFORCE_DEFERRED(snapshot, contract_check)                    \
+  AUDIT_ENFORCE_DEFERRED_IN(::contracts_lite::default_deferred_audit_pool(), \
+                            snapshot, contract_check)
+
+#endif  // CONTRACTS__DEFERRED_AUDIT_HPP_
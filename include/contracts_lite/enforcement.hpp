@@ -26,7 +26,12 @@
 #include <string>
 #include <utility>
 
-#include "contracts_lite/operators.hpp"
+#include "contracts_lite/probes.hpp"
+
+#include "contracts_lite/return_status.hpp"
+#ifdef CONTRACT_PROFILING_ON
+#include "contracts_lite/profiler.hpp"
+#endif
 
 /**
  * @brief Debug string definitions for continuation mode
@@ -59,23 +64,79 @@
  * available.
  * @note INTERNAL USE ONLY
  */
-#define CONTRACT_VIOLATION(comment)                              \
+#define CONTRACT_VIOLATION(comment) CONTRACT_VIOLATION_IN(comment, __func__)
+
+/**
+ * @brief As CONTRACT_VIOLATION, for a violation in function 'function_name'.
+ * @note INTERNAL USE ONLY
+ */
+#define CONTRACT_VIOLATION_IN(comment, function_name)            \
   ::contracts_lite::ContractViolation(                           \
       static_cast<uint_least32_t>(__LINE__), std::move(comment), \
       std::string(CONTRACT_BUILD_LEVEL),                         \
       std::string(CONTRACT_VIOLATION_CONTINUATION_MODE),         \
-      std::string(__FILE__), std::string(__func__))
+      std::string(__FILE__), std::string(function_name))
+
+/**
+ * @brief Attributes of the function reporting a violation: it is rarely
+ * called, and must not be inlined, so that building the violation does not
+ * take up code (and instruction cache) on the path where the check passes.
+ * @note INTERNAL USE ONLY
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CONTRACT_COLD_PATH __attribute__((cold, noinline))
+#else
+#define CONTRACT_COLD_PATH
+#endif
+
+/**
+ * @brief Evaluates contract_check. With CONTRACT_PROFILING_ON, the evaluation
+ * is timed, and the time added to the histogram of the enforcement site in
+ * the calling thread (see profiler.hpp). The names of the lambda are prefixed
+ * so as not to hide names used by contract_check.
+ * @note INTERNAL USE ONLY
+ */
+#ifdef CONTRACT_PROFILING_ON
+#define CONTRACT_EVALUATE(contract_check)                                    \
+  [&](const char* contract_profile_function)                                 \
+      -> ::contracts_lite::ReturnStatus {                                    \
+    namespace contract_profiler = ::contracts_lite::profiler;                \
+    static const std::size_t contract_profile_site =                         \
+        contract_profiler::registry().add(__FILE__, __LINE__,                \
+                                          contract_profile_function);        \
+    const std::uint64_t contract_profile_start =                             \
+        contract_profiler::start_time();                                     \
+    ::contracts_lite::ReturnStatus contract_profile_status = contract_check; \
+    contract_profiler::record(                                               \
+        contract_profile_site,                                               \
+        contract_profiler::stop_time() - contract_profile_start);            \
+    return contract_profile_status;                                          \
+  }(__func__)
+#else
+#define CONTRACT_EVALUATE(contract_check) contract_check
+#endif
 
 /**
  * @brief Invokes violation handler if contract_check arg evaluates to `true`
+ * @note The violation is built and handled out of line (see
+ * CONTRACT_COLD_PATH), by a lambda that is given the name of the enclosing
+ * function.
  * @note INTERNAL USE ONLY
  */
-#define ENFORCE_CONTRACT(contract_check)                             \
-  {                                                                  \
-    ::contracts_lite::ReturnStatus check = contract_check;           \
-    if (!check.status) {                                             \
-      CONTRACT_VIOLATION_HANDLER(CONTRACT_VIOLATION(check.comment)); \
-    }                                                                \
+#define ENFORCE_CONTRACT(contract_check)                              \
+  {                                                                   \
+    ::contracts_lite::ReturnStatus check =                            \
+        CONTRACT_EVALUATE(contract_check);                            \
+    CONTRACT_PROBE(check, CONTRACT_PROBE_SITE, check.status);         \
+    if (!check.status) {                                              \
+      const char* const contract_function = __func__;                 \
+      [&]() CONTRACT_COLD_PATH {                                      \
+        CONTRACT_PROBE(violation, CONTRACT_PROBE_SITE,                \
+                       check.comment.c_str());                        \
+        CONTRACT_VIOLATION_HANDLER(                                   \
+            CONTRACT_VIOLATION_IN(check.comment, contract_function)); \
+      }();                                                            \
+    }                                                                 \
   }
 
 /**
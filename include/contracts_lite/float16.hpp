@@ -0,0 +1,332 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines 16-bit floating point storage types.
+
+#ifndef CONTRACTS__FLOAT16_HPP_
+#define CONTRACTS__FLOAT16_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "contracts_lite/float_bits.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Encoding and decoding of 16-bit floats.
+ * @note INTERNAL USE ONLY
+ */
+namespace float16_detail {
+
+inline std::uint32_t bits_of(float x) {
+  std::uint32_t b;
+  std::memcpy(&b, &x, sizeof(b));
+  return b;
+}
+
+inline float float_of(std::uint32_t b) {
+  float x;
+  std::memcpy(&x, &b, sizeof(x));
+  return x;
+}
+
+/** @brief 2^n, in constant expressions. */
+constexpr double pow2(int n) {
+  double p = 1.0;
+  for (; n > 0; --n) {
+    p *= 2.0;
+  }
+  for (; n < 0; ++n) {
+    p *= 0.5;
+  }
+  return p;
+}
+
+/** @brief 'r' >= 0 rounded to the nearest integer, ties to even. */
+constexpr std::uint32_t round_half_even(double r) {
+  const auto i = static_cast<std::uint32_t>(r);
+  const double fraction = r - static_cast<double>(i);
+  return ((fraction > 0.5) || ((fraction == 0.5) && ((i & 1u) != 0)))
+             ? (i + 1u)
+             : i;
+}
+
+/**
+ * @brief Bits of the 16-bit float with 'E' exponent bits nearest to 'x',
+ * rounding ties to even. This is meant for constants: it is usable in
+ * constant expressions, but loops over the binades.
+ *
+ * @note -0 is encoded as +0, since C++14 constant expressions cannot test the
+ * sign of zero.
+ */
+template <int E>
+constexpr std::uint16_t encode(double x) {
+  constexpr int M = 15 - E;
+  constexpr int bias = (1 << (E - 1)) - 1;
+  constexpr std::uint32_t infinity = ((1u << E) - 1u) << M;
+  if (x != x) {
+    return static_cast<std::uint16_t>(infinity | (1u << (M - 1)));
+  }
+  const std::uint32_t sign = (x < 0.0) ? 0x8000u : 0u;
+  const double a = (x < 0.0) ? -x : x;
+  if (a > std::numeric_limits<double>::max()) {
+    return static_cast<std::uint16_t>(sign | infinity);
+  }
+  // Find the binade [2^e, 2^(e + 1)) of 'a', or the subnormal range.
+  int e = 0;
+  double p = 1.0;
+  while ((p > a) && (e > 1 - bias)) {
+    p *= 0.5;
+    --e;
+  }
+  while ((p * 2.0 <= a) && (e <= bias)) {
+    p *= 2.0;
+    ++e;
+  }
+  if (e > bias) {
+    return static_cast<std::uint16_t>(sign | infinity);
+  }
+  // The significand, with its leading bit for normals. Adding it to the
+  // exponent field (zero for subnormals, where e = 1 - bias) carries into the
+  // next binade, or into infinity.
+  const std::uint32_t m = round_half_even(a / p * pow2(M));
+  const std::uint32_t bits =
+      (static_cast<std::uint32_t>(e + bias - 1) << M) + m;
+  return static_cast<std::uint16_t>(sign |
+                                    ((bits < infinity) ? bits : infinity));
+}
+
+/** @brief IEEE binary16 nearest to 'x', rounding ties to even. */
+inline std::uint16_t half_from_float(float x) {
+  std::uint32_t f = bits_of(x);
+  const std::uint32_t sign = f & 0x80000000u;
+  f ^= sign;
+  std::uint32_t h;
+  if (f >= 0x47800000u) {
+    // At least 2^16, infinity or NaN: all overflow to infinity.
+    h = (f > 0x7f800000u) ? 0x7e00u : 0x7c00u;
+  } else if (f < 0x38800000u) {
+    // Below 2^-14: adding 0.5 aligns the subnormal significand, and the
+    // addition rounds it to nearest even.
+    h = bits_of(float_of(f) + 0.5f) - 0x3f000000u;
+  } else {
+    // Rebias the exponent and round the 13 dropped bits to nearest even.
+    const std::uint32_t odd = (f >> 13) & 1u;
+    f += 0xc8000fffu + odd;
+    h = f >> 13;
+  }
+  return static_cast<std::uint16_t>(h | (sign >> 16));
+}
+
+/** @brief Float equal to the IEEE binary16 with bits 'h'. */
+inline float float_from_half(std::uint16_t h) {
+  constexpr std::uint32_t exponent = 0x7c00u << 13;
+  std::uint32_t f = (h & 0x7fffu) << 13;
+  const std::uint32_t e = f & exponent;
+  f += (127u - 15u) << 23;
+  if (e == exponent) {
+    // Infinity or NaN.
+    f += (128u - 16u) << 23;
+  } else if (e == 0) {
+    // Zero or subnormal: renormalize by subtracting the implicit bit.
+    f = bits_of(float_of(f + (1u << 23)) - float_of(113u << 23));
+  }
+  return float_of(f | (static_cast<std::uint32_t>(h & 0x8000u) << 16));
+}
+
+/** @brief bfloat16 nearest to 'x', rounding ties to even. */
+inline std::uint16_t bfloat_from_float(float x) {
+  const std::uint32_t f = bits_of(x);
+  if ((f & 0x7fffffffu) > 0x7f800000u) {
+    // Keep NaN quiet, which rounding could turn into infinity.
+    return static_cast<std::uint16_t>((f >> 16) | 0x40u);
+  }
+  return static_cast<std::uint16_t>((f + 0x7fffu + ((f >> 16) & 1u)) >> 16);
+}
+
+/** @brief Float equal to the bfloat16 with bits 'b'. */
+inline float float_from_bfloat(std::uint16_t b) {
+  return float_of(static_cast<std::uint32_t>(b) << 16);
+}
+
+}  // namespace float16_detail
+
+/**
+ * @brief Storage type for 16-bit floats with 'E' exponent bits: float16
+ * (IEEE binary16) or bfloat16 (the upper half of a float).
+ *
+ * These halve the memory and bandwidth of large buffers of reals. Arithmetic
+ * is done in float: values convert implicitly and exactly to float, and
+ * explicitly from float, rounding to nearest even. Conversions from double
+ * are usable in constant expressions, e.g., for the bounds of BoundedReal.
+ *
+ * @note These are trivial types with the size of their bits, so that arrays of
+ * them can be copied to and from external buffers. The default constructor
+ * leaves the value uninitialized, as for float.
+ */
+template <int E>
+class Binary16 {
+  static_assert(E == 5 || E == 8, "Only float16 and bfloat16 are supported.");
+
+ public:
+  static constexpr int exponent_bits = E;
+  static constexpr int mantissa_bits = 15 - E;
+
+  Binary16() = default;
+
+  /** @brief Nearest value to 'x'. */
+  explicit Binary16(float x) : bits_(from_float(x)) {}
+
+  /** @brief Nearest value to 'x', in constant expressions. -0 becomes +0. */
+  explicit constexpr Binary16(double x)
+      : bits_(float16_detail::encode<E>(x)) {}
+
+  /** @brief Exact conversion to float. */
+  operator float() const {
+    return (E == 5) ? float16_detail::float_from_half(bits_)
+                    : float16_detail::float_from_bfloat(bits_);
+  }
+
+  /** @brief Exact negation, flipping the sign bit. */
+  constexpr Binary16 operator-() const {
+    return from_bits(static_cast<std::uint16_t>(bits_ ^ 0x8000u));
+  }
+
+  static constexpr Binary16 from_bits(std::uint16_t bits) {
+    return Binary16(bits, BitsTag());
+  }
+
+  constexpr std::uint16_t bits() const { return bits_; }
+
+ private:
+  struct BitsTag {};
+  constexpr Binary16(std::uint16_t bits, BitsTag) : bits_(bits) {}
+
+  static std::uint16_t from_float(float x) {
+    return (E == 5) ? float16_detail::half_from_float(x)
+                    : float16_detail::bfloat_from_float(x);
+  }
+
+  std::uint16_t bits_;
+};
+
+/** @brief IEEE binary16: 5 exponent bits and 10 mantissa bits. */
+using float16 = Binary16<5>;
+
+/** @brief bfloat16: the 8 exponent bits of float, and 7 mantissa bits. */
+using bfloat16 = Binary16<8>;
+
+namespace float_bits {
+
+template <int E>
+struct traits<Binary16<E>> {
+  using bits_type = std::uint16_t;
+  static constexpr bits_type sign_mask = 0x8000u;
+  static constexpr bits_type exponent_mask =
+      static_cast<bits_type>(((1u << E) - 1u) << (15 - E));
+};
+
+/** @brief bfloat16 is not an IEEE format, but has the same layout. */
+template <>
+struct has_ieee_layout<bfloat16> : std::true_type {};
+
+/**
+ * @brief 16-bit floats are always compared on their bits, which is exact and
+ * needs no conversion to float.
+ */
+template <int E>
+struct comparison<Binary16<E>> {
+  static constexpr bool less(Binary16<E> a, Binary16<E> b) {
+    return ordered_key_of_bits<Binary16<E>>(a.bits()) <
+           ordered_key_of_bits<Binary16<E>>(b.bits());
+  }
+  static constexpr bool less_equal(Binary16<E> a, Binary16<E> b) {
+    return ordered_key_of_bits<Binary16<E>>(a.bits()) <=
+           ordered_key_of_bits<Binary16<E>>(b.bits());
+  }
+};
+
+}  // namespace float_bits
+}  // namespace contracts_lite
+
+namespace std {
+
+/** @brief Limits of 16-bit floats, as for float. */
+template <int E>
+class numeric_limits<contracts_lite::Binary16<E>> {
+  using T = contracts_lite::Binary16<E>;
+  static constexpr int bias = (1 << (E - 1)) - 1;
+  static constexpr std::uint16_t bits(std::uint32_t exponent,
+                                      std::uint32_t mantissa) {
+    return static_cast<std::uint16_t>((exponent << (15 - E)) | mantissa);
+  }
+
+ public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr bool has_signaling_NaN = true;
+  static constexpr float_denorm_style has_denorm = denorm_present;
+  static constexpr bool has_denorm_loss = false;
+  static constexpr float_round_style round_style = round_to_nearest;
+  static constexpr bool is_iec559 = (E == 5);
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = false;
+  static constexpr int digits = 16 - E;
+  static constexpr int digits10 = (E == 5) ? 3 : 2;
+  static constexpr int max_digits10 = (E == 5) ? 5 : 4;
+  static constexpr int radix = 2;
+  static constexpr int min_exponent = 2 - bias;
+  static constexpr int min_exponent10 = (E == 5) ? -4 : -37;
+  static constexpr int max_exponent = bias + 1;
+  static constexpr int max_exponent10 = (E == 5) ? 4 : 38;
+  static constexpr bool traps = false;
+  static constexpr bool tinyness_before = false;
+
+  static constexpr T min() { return T::from_bits(bits(1, 0)); }
+  static constexpr T lowest() {
+    return T::from_bits(static_cast<std::uint16_t>(0x8000u | max().bits()));
+  }
+  static constexpr T max() {
+    return T::from_bits(bits((1u << E) - 2u, (1u << (15 - E)) - 1u));
+  }
+  static constexpr T epsilon() {
+    return T::from_bits(bits(static_cast<std::uint32_t>(bias - (15 - E)), 0));
+  }
+  static constexpr T round_error() {
+    return T::from_bits(bits(static_cast<std::uint32_t>(bias - 1), 0));
+  }
+  static constexpr T infinity() {
+    return T::from_bits(bits((1u << E) - 1u, 0));
+  }
+  static constexpr T quiet_NaN() {
+    return T::from_bits(bits((1u << E) - 1u, 1u << (14 - E)));
+  }
+  static constexpr T signaling_NaN() {
+    return T::from_bits(bits((1u << E) - 1u, 1u << (13 - E)));
+  }
+  static constexpr T denorm_min() { return T::from_bits(1); }
+};
+
+}  // namespace std
+
+#endif  // CONTRACTS__FLOAT16_HPP_
@@ -0,0 +1,206 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines float predicates and comparisons on IEEE-754 bit
+/// patterns.
+
+#ifndef CONTRACTS__FLOAT_BITS_HPP_
+#define CONTRACTS__FLOAT_BITS_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @brief Defined if the compiler may assume that floats are never NaN or
+ * infinite, e.g., with -ffast-math or -ffinite-math-only.
+ */
+#if defined(__FINITE_MATH_ONLY__) && __FINITE_MATH_ONLY__
+#define CONTRACT_FINITE_MATH_ONLY
+#endif
+
+namespace contracts_lite {
+
+/**
+ * @brief Predicates and comparisons that test the sign and exponent bits of
+ * floats as integers.
+ *
+ * Under -ffast-math or -ffinite-math-only, compilers may assume that NaN and
+ * infinities never occur, and fold std::isnan(x) to false or x < inf to true.
+ * Integer operations on the bit pattern are outside of those assumptions, so
+ * these keep detecting NaN and infinities. They have no branches, so loops
+ * over them vectorize.
+ */
+namespace float_bits {
+
+/** @brief Unsigned integer of the size of 'T' and its masks. */
+template <typename T>
+struct traits;
+
+template <>
+struct traits<float> {
+  using bits_type = std::uint32_t;
+  static constexpr bits_type sign_mask = 0x80000000u;
+  static constexpr bits_type exponent_mask = 0x7f800000u;
+};
+
+template <>
+struct traits<double> {
+  using bits_type = std::uint64_t;
+  static constexpr bits_type sign_mask = 0x8000000000000000u;
+  static constexpr bits_type exponent_mask = 0x7ff0000000000000u;
+};
+
+/**
+ * @brief Whether 'T' has the sign, exponent and mantissa layout of IEEE-754
+ * floats, so that these functions apply.
+ */
+template <typename T>
+struct has_ieee_layout
+    : std::integral_constant<bool, std::numeric_limits<T>::is_iec559> {};
+
+/** @brief The bit pattern of 'x'. */
+template <typename T>
+typename traits<T>::bits_type to_bits(T x) {
+  typename traits<T>::bits_type b;
+  std::memcpy(&b, &x, sizeof(b));
+  return b;
+}
+
+/** @brief Whether 'x' is not infinite or NaN: its exponent is not all ones. */
+template <typename T>
+bool is_finite(T x) {
+  return (to_bits(x) & traits<T>::exponent_mask) != traits<T>::exponent_mask;
+}
+
+/** @brief Whether 'x' is NaN: its magnitude is above that of infinity. */
+template <typename T>
+bool is_nan(T x) {
+  return (to_bits(x) & ~traits<T>::sign_mask) > traits<T>::exponent_mask;
+}
+
+/**
+ * @brief long double has no portable layout, so it is tested with a compare,
+ * which fast-math may fold.
+ */
+inline bool is_nan(long double x) { return x != x; }
+
+/** @brief Whether 'x' is positive or negative infinity. */
+template <typename T>
+bool is_inf(T x) {
+  return (to_bits(x) & ~traits<T>::sign_mask) == traits<T>::exponent_mask;
+}
+
+/** @brief Whether the sign bit of 'x' is set, including for -0 and NaN. */
+template <typename T>
+bool sign_bit(T x) {
+  return (to_bits(x) & traits<T>::sign_mask) != 0;
+}
+
+/**
+ * @brief Unsigned key that orders floats as their values, from the bit pattern
+ * 'b' of a float of type 'T': for floats 'a' and 'b' not NaN, a < b if and only
+ * if ordered_key(a) < ordered_key(b), and -0 and +0 have the same key. NaN
+ * with the sign bit clear orders above +inf, and with the sign bit set below
+ * -inf.
+ *
+ * Negative magnitudes are negated, as the sign-magnitude encoding of floats is
+ * converted to two's complement, and the result is offset by the sign mask.
+ */
+template <typename T>
+constexpr typename traits<T>::bits_type ordered_key_of_bits(
+    typename traits<T>::bits_type b) {
+  using B = typename traits<T>::bits_type;
+  const B negative = static_cast<B>(b >> (std::numeric_limits<B>::digits - 1));
+  const B magnitude = static_cast<B>(b & ~traits<T>::sign_mask);
+  return static_cast<B>(traits<T>::sign_mask +
+                        ((magnitude ^ (B(0) - negative)) + negative));
+}
+
+/** @brief See ordered_key_of_bits. */
+template <typename T>
+typename traits<T>::bits_type ordered_key(T x) {
+  return ordered_key_of_bits<T>(to_bits(x));
+}
+
+/**
+ * @brief Comparisons used by the range checks (see range_checks.hpp).
+ *
+ * They compare with the built-in operators, except when compiling with
+ * CONTRACT_FINITE_MATH_ONLY, where floats and doubles are compared through
+ * ordered_key at run time. Since NaN orders outside of the infinities, a range
+ * check with bounds that are not NaN then fails for NaN, as it does with the
+ * operators in IEEE-compliant builds. They remain usable in constant
+ * expressions, which are not affected by fast-math.
+ *
+ * Other number types may specialize 'comparison' (see float16.hpp).
+ *
+ * @note Translation units linked together should agree on fast-math, since the
+ * definitions of these functions depend on it.
+ */
+template <typename T>
+struct comparison {
+  static constexpr bool less(T a, T b) { return a < b; }
+  static constexpr bool less_equal(T a, T b) { return a <= b; }
+};
+
+#ifdef CONTRACT_FINITE_MATH_ONLY
+#define CONTRACT_FLOAT_BITS_COMPARISON(T)              \
+  template <>                                          \
+  struct comparison<T> {                               \
+    static constexpr bool less(T a, T b) {             \
+      return __builtin_is_constant_evaluated()         \
+                 ? (a < b)                             \
+                 : (ordered_key(a) < ordered_key(b));  \
+    }                                                  \
+    static constexpr bool less_equal(T a, T b) {       \
+      return __builtin_is_constant_evaluated()         \
+                 ? (a <= b)                            \
+                 : (ordered_key(a) <= ordered_key(b)); \
+    }                                                  \
+  };
+
+CONTRACT_FLOAT_BITS_COMPARISON(float)
+CONTRACT_FLOAT_BITS_COMPARISON(double)
+
+#undef CONTRACT_FLOAT_BITS_COMPARISON
+#endif
+
+template <typename T>
+constexpr bool less(T a, T b) {
+  return comparison<T>::less(a, b);
+}
+
+template <typename T>
+constexpr bool less_equal(T a, T b) {
+  return comparison<T>::less_equal(a, b);
+}
+
+template <typename T>
+constexpr bool greater(T a, T b) {
+  return comparison<T>::less(b, a);
+}
+
+template <typename T>
+constexpr bool greater_equal(T a, T b) {
+  return comparison<T>::less_equal(b, a);
+}
+
+}  // namespace float_bits
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__FLOAT_BITS_HPP_
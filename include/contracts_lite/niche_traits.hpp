@@ -0,0 +1,68 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTRACTS__NICHE_TRAITS_HPP_
+#define CONTRACTS__NICHE_TRAITS_HPP_
+
+#include <limits>
+
+#include "contracts_lite/float_bits.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Traits describing a 'niche' of a contract type: a value of its
+ * underlying representation that violates the type invariant, and can
+ * therefore represent the empty state of contracts_lite::optional.
+ *
+ * Specializations with a niche define:
+ * - has_niche: true
+ * - storage_type: the underlying representation
+ * - empty(): the niche value
+ * - is_empty(storage_type): whether a value is the niche
+ *
+ * The type must also be constructible from (storage_type, assume_valid_t).
+ *
+ * @note This primary template is for types without a niche.
+ */
+template <typename X>
+struct niche_traits {
+  static constexpr bool has_niche = false;
+};
+
+/** @brief Niche traits for floating point types that reject NaN. */
+template <typename T>
+struct nan_niche_traits {
+  static_assert(std::numeric_limits<T>::has_quiet_NaN,
+                "NaN niche requires a type with a quiet NaN.");
+
+  static constexpr bool has_niche = true;
+  using storage_type = T;
+  static constexpr T empty() { return std::numeric_limits<T>::quiet_NaN(); }
+  // Test the bits, since value != value is folded to false with fast-math.
+  static bool is_empty(T value) { return float_bits::is_nan(value); }
+};
+
+/** @brief Niche traits for integral types that reject the value 'NICHE'. */
+template <typename T, T NICHE>
+struct value_niche_traits {
+  static constexpr bool has_niche = true;
+  using storage_type = T;
+  static constexpr T empty() { return NICHE; }
+  static constexpr bool is_empty(T value) { return (value == NICHE); }
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__NICHE_TRAITS_HPP_
@@ -0,0 +1,148 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines an optional type for contract types.
+
+#ifndef CONTRACTS__OPTIONAL_HPP_
+#define CONTRACTS__OPTIONAL_HPP_
+
+#include <type_traits>
+#include <utility>
+
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/niche_traits.hpp"
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+
+/** @brief Tag type for an empty optional. */
+struct nullopt_t {
+  explicit constexpr nullopt_t(int) {}
+};
+
+/** @brief Tag object for an empty optional. */
+constexpr nullopt_t nullopt{0};
+
+/**
+ * @brief Optional value of contract type 'X'.
+ *
+ * If 'X' has a niche (see niche_traits), the empty state is stored as the
+ * niche value, so the optional is the same size as 'X' and checking for a
+ * value is a single comparison. Otherwise, a separate flag is stored.
+ *
+ * @note Accessing the value of an empty optional is a contract violation.
+ * value() enforces this at the DEFAULT level and operator* at the AUDIT level.
+ */
+template <typename X, bool = niche_traits<X>::has_niche>
+class optional {
+  static_assert(std::is_trivially_copyable<X>::value,
+                "optional requires a trivially copyable contract type.");
+
+ public:
+  optional() : empty_(), has_value_(false) {}
+  optional(nullopt_t) : optional() {}
+  optional(X x) : value_(x), has_value_(true) {}
+
+  optional& operator=(nullopt_t) {
+    reset();
+    return *this;
+  }
+
+  /** @brief Whether this object contains a value. */
+  bool has_value() const { return has_value_; }
+  explicit operator bool() const { return has_value(); }
+
+  /** @brief Get the value. */
+  X value() const {
+    DEFAULT_ENFORCE(optional::check(*this));
+    return value_;
+  }
+
+  /** @brief Get the value without checking outside of AUDIT builds. */
+  X operator*() const {
+    AUDIT_ENFORCE(optional::check(*this));
+    return value_;
+  }
+
+  /** @brief Get the value, or 'x' if this object is empty. */
+  X value_or(X x) const { return has_value_ ? value_ : x; }
+
+  /** @brief Make this object empty. */
+  void reset() { has_value_ = false; }
+
+  /** @brief Check that this object contains a value. */
+  static ReturnStatus check(const optional& o) {
+    return ReturnStatus("optional must contain a value", o.has_value());
+  }
+
+ private:
+  union {
+    char empty_;
+    X value_;
+  };
+  bool has_value_;
+};
+
+/** @brief Optional specialization storing the empty state in a niche. */
+template <typename X>
+class optional<X, true> {
+  using traits = niche_traits<X>;
+  using storage_type = typename traits::storage_type;
+
+ public:
+  optional() : v_(traits::empty()) {}
+  optional(nullopt_t) : optional() {}
+  optional(X x) : v_(static_cast<storage_type>(x)) {}
+
+  optional& operator=(nullopt_t) {
+    reset();
+    return *this;
+  }
+
+  /** @brief Whether this object contains a value. */
+  bool has_value() const { return !traits::is_empty(v_); }
+  explicit operator bool() const { return has_value(); }
+
+  /** @brief Get the value. */
+  X value() const {
+    DEFAULT_ENFORCE(optional::check(*this));
+    return X(v_, assume_valid);
+  }
+
+  /** @brief Get the value without checking outside of AUDIT builds. */
+  X operator*() const {
+    AUDIT_ENFORCE(optional::check(*this));
+    return X(v_, assume_valid);
+  }
+
+  /** @brief Get the value, or 'x' if this object is empty. */
+  X value_or(X x) const { return has_value() ? X(v_, assume_valid) : x; }
+
+  /** @brief Make this object empty. */
+  void reset() { v_ = traits::empty(); }
+
+  /** @brief Check that this object contains a value. */
+  static ReturnStatus check(const optional& o) {
+    return ReturnStatus("optional must contain a value", o.has_value());
+  }
+
+ private:
+  storage_type v_;
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__OPTIONAL_HPP_
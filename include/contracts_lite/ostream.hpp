@@ -0,0 +1,43 @@
+// Copyright 2020 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ostream.hpp
+ * Stream operators for ReturnStatus and ContractViolation. These are opt-in,
+ * so that checks do not pay the compile time of iostreams.
+ */
+
+#ifndef CONTRACTS__OSTREAM_HPP_
+#define CONTRACTS__OSTREAM_HPP_
+
+#include <ostream>
+
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+
+/** @brief Print status object to stream. */
+inline std::ostream& operator<<(std::ostream& os, const ReturnStatus& r) {
+  return (os << r.comment);
+}
+
+/** @brief Stream overload for printing contract violation to string. */
+inline std::ostream& operator<<(std::ostream& os,
+                                const ContractViolation& cv) {
+  return (os << ContractViolation::string(cv));
+}
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__OSTREAM_HPP_
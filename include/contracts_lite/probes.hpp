@@ -0,0 +1,110 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines static tracepoints (USDT probes) of checks.
+
+#ifndef CONTRACTS__PROBES_HPP_
+#define CONTRACTS__PROBES_HPP_
+
+/**
+ * @file probes.hpp
+ * With CONTRACT_PROBES_ON, the enforcement macros have static tracepoints,
+ * in the format of SystemTap's <sys/sdt.h>, which perf, bpftrace and
+ * SystemTap attach to:
+ *
+ * - contracts_lite:check(site, passed), after a check is evaluated, and
+ * - contracts_lite:violation(site, comment), before the violation handler,
+ *
+ * where 'site' is the string "file:line" of the enforcement site, 'passed' is
+ * 1 or 0, and 'comment' is the comment of the failed check. A probe is a nop
+ * in the code and an ELF note with the location of the nop and its arguments,
+ * so with no tracer attached it costs the nop and setting up the arguments.
+ *
+ * <sys/sdt.h> is used where it is available, and otherwise the notes are
+ * emitted here, for x86-64 ELF targets.
+ */
+
+#include <cstdint>
+
+#define CONTRACT_PROBE_STRINGIZE_(x) #x
+#define CONTRACT_PROBE_STRINGIZE(x) CONTRACT_PROBE_STRINGIZE_(x)
+
+/** @brief Site argument of the probes, "file:line". */
+#define CONTRACT_PROBE_SITE __FILE__ ":" CONTRACT_PROBE_STRINGIZE(__LINE__)
+
+/** @brief Without CONTRACT_PROBES_ON, there are no probes. */
+#ifndef CONTRACT_PROBES_ON
+#define CONTRACT_PROBE(name, site, arg)
+#else
+
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define CONTRACT_PROBES_SDT
+#endif
+#endif
+
+#if defined(CONTRACT_PROBES_SDT)
+#include <sys/sdt.h>
+
+#define CONTRACT_PROBE(name, site, arg) \
+  DTRACE_PROBE2(contracts_lite, name, site, arg)
+
+#elif defined(__x86_64__) && defined(__ELF__) && \
+    (defined(__GNUC__) || defined(__clang__))
+
+/**
+ * @brief Probe 'name' of provider contracts_lite, with two 64-bit arguments.
+ *
+ * The note is as emitted by <sys/sdt.h> (note type 3, "stapsdt"): the address
+ * of the nop, the address of the _.stapsdt.base section, used by tracers to
+ * adjust the address of prelinked binaries, a zero semaphore address, the
+ * provider, the name, and the argument formats "size@operand". Arguments are
+ * passed as 64-bit integers (the casts also convert pointers).
+ */
+#define CONTRACT_PROBE(name, site, arg)                                  \
+  __asm__ __volatile__(                                                  \
+      "990: nop\n"                                                       \
+      ".pushsection .note.stapsdt,\"?\",\"note\"\n"                      \
+      ".balign 4\n"                                                      \
+      ".4byte 992f-991f, 994f-993f, 3\n"                                 \
+      "991: .asciz \"stapsdt\"\n"                                        \
+      "992: .balign 4\n"                                                 \
+      "993: .8byte 990b\n"                                               \
+      ".8byte _.stapsdt.base\n"                                          \
+      ".8byte 0\n"                                                       \
+      ".asciz \"contracts_lite\"\n"                                      \
+      ".asciz \"" #name "\"\n"                                           \
+      ".asciz \"8@%0 8@%1\"\n"                                           \
+      "994: .balign 4\n"                                                 \
+      ".popsection\n"                                                    \
+      ".ifndef _.stapsdt.base\n"                                         \
+      ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+      ".weak _.stapsdt.base\n"                                           \
+      ".hidden _.stapsdt.base\n"                                         \
+      "_.stapsdt.base: .space 1\n"                                       \
+      ".size _.stapsdt.base, 1\n"                                        \
+      ".popsection\n"                                                    \
+      ".endif\n"                                                         \
+      :                                                                  \
+      : "nor"((::std::uint64_t)(site)), "nor"((::std::uint64_t)(arg)))
+
+#else
+#error "CONTRACT_PROBES_ON requires <sys/sdt.h> or an x86-64 ELF target."
+#endif
+
+#endif  // CONTRACT_PROBES_ON
+
+#endif  // CONTRACTS__PROBES_HPP_
@@ -0,0 +1,336 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines a profiler of the cost of contract checks.
+
+#ifndef CONTRACTS__PROFILER_HPP_
+#define CONTRACTS__PROFILER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define CONTRACT_PROFILER_TSC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace contracts_lite {
+namespace profiler {
+
+/**
+ * @brief Time stamp at the start of a timed region: ticks of the time stamp
+ * counter on x86, and nanoseconds elsewhere.
+ *
+ * The fences keep earlier instructions out of the region, and the instructions
+ * of the region from starting before the counter is read.
+ */
+inline std::uint64_t start_time() {
+#ifdef CONTRACT_PROFILER_TSC
+  _mm_lfence();
+  const std::uint64_t t = __rdtsc();
+  _mm_lfence();
+  return t;
+#else
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+/**
+ * @brief Time stamp at the end of a timed region (see start_time).
+ *
+ * rdtscp waits for the instructions of the region to complete, and the fence
+ * keeps later instructions out of the region.
+ */
+inline std::uint64_t stop_time() {
+#ifdef CONTRACT_PROFILER_TSC
+  unsigned int aux;
+  const std::uint64_t t = __rdtscp(&aux);
+  _mm_lfence();
+  return t;
+#else
+  return start_time();
+#endif
+}
+
+/** @brief Unit of the times reported by the profiler. */
+inline const char* time_unit() {
+#ifdef CONTRACT_PROFILER_TSC
+  return "TSC ticks";
+#else
+  return "ns";
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Histogram of times on a log scale: bucket 0 counts zero times, and
+ * bucket b > 0 counts times in [2^(b-1), 2^b).
+ */
+class Histogram {
+ public:
+  static constexpr std::size_t buckets = 65;
+
+  void add(std::uint64_t t) {
+    ++counts_[bucket(t)];
+    ++count_;
+    total_ += t;
+  }
+
+  void merge(const Histogram& other) {
+    for (std::size_t b = 0; b < buckets; ++b) {
+      counts_[b] += other.counts_[b];
+    }
+    count_ += other.count_;
+    total_ += other.total_;
+  }
+
+  std::uint64_t count() const { return count_; }
+  std::uint64_t total() const { return total_; }
+  std::uint64_t bucket_count(std::size_t b) const { return counts_[b]; }
+
+  double mean() const {
+    return (count_ == 0) ? 0.0
+                         : static_cast<double>(total_) /
+                               static_cast<double>(count_);
+  }
+
+  /**
+   * @brief Upper bound of the 'q' quantile, for 'q' in [0, 1]: the largest
+   * time in the bucket holding it.
+   */
+  std::uint64_t quantile_bound(double q) const {
+    const auto rank =
+        static_cast<std::uint64_t>(q * static_cast<double>(count_));
+    std::uint64_t seen = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+      seen += counts_[b];
+      if (seen > rank || seen == count_) {
+        return upper_bound(b);
+      }
+    }
+    return 0;
+  }
+
+  /** @brief Bucket of time 't', its number of significant bits. */
+  static std::size_t bucket(std::uint64_t t) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (t == 0) ? 0 : static_cast<std::size_t>(64 - __builtin_clzll(t));
+#else
+    std::size_t b = 0;
+    for (; t != 0; t >>= 1) {
+      ++b;
+    }
+    return b;
+#endif
+  }
+
+  /** @brief Largest time in bucket 'b'. */
+  static std::uint64_t upper_bound(std::size_t b) {
+    return (b == 0) ? 0 : (~std::uint64_t{0} >> (64 - b));
+  }
+
+ private:
+  std::array<std::uint64_t, buckets> counts_{};
+  std::uint64_t count_ = 0;
+  std::uint64_t total_ = 0;
+};
+
+/** @brief Times of the check at one enforcement site. */
+struct SiteStats {
+  const char* file;
+  unsigned int line;
+  const char* function;
+  Histogram histogram;
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Enforcement sites and the histograms merged from the threads that
+ * timed them.
+ */
+class Registry {
+ public:
+  /**
+   * @brief Calibrates the overhead of timing: the median time of an empty
+   * timed region.
+   */
+  Registry() {
+    std::array<std::uint64_t, 1001> samples;
+    for (auto& s : samples) {
+      const std::uint64_t start = start_time();
+      s = stop_time() - start;
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2,
+                     samples.end());
+    overhead_ = samples[samples.size() / 2];
+  }
+
+  Registry(const Registry&) = delete;
+  Registry& operator=(const Registry&) = delete;
+
+  /** @brief Prints the report at exit, unless disabled. */
+  ~Registry() {
+    if (report_at_exit_) {
+      report(stderr);
+    }
+  }
+
+  /** @brief Adds a site, returning its index. */
+  std::size_t add(const char* file, unsigned int line, const char* function) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sites_.push_back(SiteStats{file, line, function, Histogram()});
+    return sites_.size() - 1;
+  }
+
+  /** @brief Adds the histograms of a thread, indexed by site. */
+  void merge(const std::vector<Histogram>& histograms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < histograms.size(); ++i) {
+      sites_[i].histogram.merge(histograms[i]);
+    }
+  }
+
+  /** @brief The sites timed at least once, by decreasing total time. */
+  std::vector<SiteStats> ranked() const {
+    std::vector<SiteStats> sites;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::copy_if(sites_.begin(), sites_.end(), std::back_inserter(sites),
+                   [](const SiteStats& s) { return s.histogram.count() > 0; });
+    }
+    std::stable_sort(sites.begin(), sites.end(),
+                     [](const SiteStats& a, const SiteStats& b) {
+                       return a.histogram.total() > b.histogram.total();
+                     });
+    return sites;
+  }
+
+  /** @brief Prints the ranked sites to 'out'. */
+  void report(std::FILE* out) const {
+    const auto sites = ranked();
+    if (sites.empty()) {
+      return;
+    }
+    std::fprintf(out,
+                 "CONTRACT PROFILE (%s, less a timing overhead of %llu)\n"
+                 "%4s %12s %14s %10s %8s %8s  %s\n",
+                 time_unit(), static_cast<unsigned long long>(overhead_),
+                 "rank", "count", "total", "mean", "p50<=", "p99<=", "site");
+    for (std::size_t i = 0; i < sites.size(); ++i) {
+      const auto& h = sites[i].histogram;
+      std::fprintf(out, "%4zu %12llu %14llu %10.1f %8llu %8llu  %s:%u (%s)\n",
+                   i + 1, static_cast<unsigned long long>(h.count()),
+                   static_cast<unsigned long long>(h.total()), h.mean(),
+                   static_cast<unsigned long long>(h.quantile_bound(0.5)),
+                   static_cast<unsigned long long>(h.quantile_bound(0.99)),
+                   sites[i].file, sites[i].line, sites[i].function);
+    }
+  }
+
+  /** @brief Median time of an empty timed region, subtracted from times. */
+  std::uint64_t overhead() const { return overhead_; }
+
+  void set_report_at_exit(bool report_at_exit) {
+    report_at_exit_ = report_at_exit;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<SiteStats> sites_;
+  std::uint64_t overhead_;
+  bool report_at_exit_ = true;
+};
+
+/** @brief Registry of the sites of the program. */
+inline Registry& registry() {
+  static Registry r;
+  return r;
+}
+
+/**
+ * @brief Histograms of the calling thread, indexed by site, which are merged
+ * into the registry when the thread exits or on flush().
+ *
+ * @note The registry is constructed before the first site records a time, so
+ * at exit it is destroyed after the histograms of the main thread.
+ */
+class ThreadHistograms {
+ public:
+  ThreadHistograms() = default;
+  ThreadHistograms(const ThreadHistograms&) = delete;
+  ThreadHistograms& operator=(const ThreadHistograms&) = delete;
+
+  ~ThreadHistograms() { flush(); }
+
+  void record(std::size_t site, std::uint64_t t) {
+    if (site >= histograms_.size()) {
+      histograms_.resize(site + 1);
+    }
+    histograms_[site].add(t);
+  }
+
+  void flush() {
+    registry().merge(histograms_);
+    histograms_.clear();
+  }
+
+ private:
+  std::vector<Histogram> histograms_;
+};
+
+inline ThreadHistograms& thread_histograms() {
+  thread_local ThreadHistograms histograms;
+  return histograms;
+}
+
+/** @brief Records the time 't' of a check at 'site', less the overhead. */
+inline void record(std::size_t site, std::uint64_t t) {
+  const std::uint64_t overhead = registry().overhead();
+  thread_histograms().record(site, (t > overhead) ? (t - overhead) : 0);
+}
+
+/**
+ * @brief Merges the times of the calling thread into the registry. The times
+ * of other threads are merged when they exit.
+ */
+inline void flush() { thread_histograms().flush(); }
+
+/** @brief Flushes the calling thread and prints the ranked sites to 'out'. */
+inline void report(std::FILE* out = stderr) {
+  flush();
+  registry().report(out);
+}
+
+}  // namespace profiler
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__PROFILER_HPP_
@@ -15,76 +15,191 @@
 #ifndef CONTRACTS__RANGE_CHECKS_HPP_
 #define CONTRACTS__RANGE_CHECKS_HPP_
 
+#include <limits>
+#include <type_traits>
 #include <utility>
 
-#include "contracts_lite/operators.hpp"
+#include "contracts_lite/float_bits.hpp"
+#include "contracts_lite/return_status.hpp"
 
 namespace contracts_lite {
 namespace range_checks {
 
+/**
+ * @brief Get the largest representable value strictly less than 'value'.
+ *
+ * This is useful for clamping computed values into a range that is open at the
+ * upper bound.
+ *
+ * @pre 'value' must be a normal, strictly positive floating point value.
+ * @note Unlike std::nextafter, this is usable in constant expressions.
+ */
+template <typename T>
+constexpr T previous_representable(T value) {
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "previous_representable requires an IEEE float type.");
+  // Find the binade [p, 2p) containing value; the spacing below value is
+  // p * epsilon unless value is exactly p, where the spacing halves.
+  T p = static_cast<T>(1);
+  while (p > value) {
+    p *= static_cast<T>(0.5);
+  }
+  while ((p * static_cast<T>(2)) <= value) {
+    p *= static_cast<T>(2);
+  }
+  const auto ulp = p * std::numeric_limits<T>::epsilon();
+  return (value == p) ? (value - ulp * static_cast<T>(0.5)) : (value - ulp);
+}
+
+/**
+ * @brief Branch-free interval tests, which the range checks below use.
+ *
+ * For floats, the two bounds are compared as in float_bits.hpp and the
+ * results combined with '&' rather than '&&', so the test has no branch of its
+ * own (where the result is branched on, GCC may still branch on each
+ * comparison). For integers (other than bool), the test
+ * is a single unsigned compare of the offset of 'value' from 'min' with the
+ * width of the interval, which wraps around for values below 'min'. The
+ * comparison of the bounds with each other keeps the result right for empty
+ * intervals, and folds away when the bounds are constants.
+ * @note INTERNAL USE ONLY
+ */
+template <typename U, typename = void>
+struct IntervalTest {
+  static constexpr bool open_open(U value, U min, U max) {
+    const bool inside_min = float_bits::greater(value, min);
+    const bool inside_max = float_bits::less(value, max);
+    return inside_min & inside_max;
+  }
+  static constexpr bool closed_open(U value, U min, U max) {
+    const bool inside_min = float_bits::greater_equal(value, min);
+    const bool inside_max = float_bits::less(value, max);
+    return inside_min & inside_max;
+  }
+  static constexpr bool open_closed(U value, U min, U max) {
+    const bool inside_min = float_bits::greater(value, min);
+    const bool inside_max = float_bits::less_equal(value, max);
+    return inside_min & inside_max;
+  }
+  static constexpr bool closed_closed(U value, U min, U max) {
+    const bool inside_min = float_bits::greater_equal(value, min);
+    const bool inside_max = float_bits::less_equal(value, max);
+    return inside_min & inside_max;
+  }
+};
+
+template <typename U>
+struct IntervalTest<
+    U, typename std::enable_if<std::is_integral<U>::value &&
+                               !std::is_same<U, bool>::value>::type> {
+  using Unsigned = typename std::make_unsigned<U>::type;
+
+  /** @brief 'a - b' modulo 2^N, for N the number of bits of U. */
+  static constexpr Unsigned difference(U a, U b) {
+    return static_cast<Unsigned>(static_cast<Unsigned>(a) -
+                                 static_cast<Unsigned>(b));
+  }
+
+  /** @brief 'a - 1' modulo 2^N. */
+  static constexpr Unsigned decrement(Unsigned a) {
+    return static_cast<Unsigned>(a - 1u);
+  }
+
+  static constexpr bool open_open(U value, U min, U max) {
+    const bool nonempty = (min < max);
+    const bool inside = decrement(difference(value, min)) <
+                        decrement(difference(max, min));
+    return nonempty & inside;
+  }
+  static constexpr bool closed_open(U value, U min, U max) {
+    const bool nonempty = (min < max);
+    const bool inside = difference(value, min) < difference(max, min);
+    return nonempty & inside;
+  }
+  static constexpr bool open_closed(U value, U min, U max) {
+    const bool nonempty = (min < max);
+    const bool inside =
+        decrement(difference(value, min)) < difference(max, min);
+    return nonempty & inside;
+  }
+  static constexpr bool closed_closed(U value, U min, U max) {
+    const bool nonempty = (min <= max);
+    const bool inside = difference(value, min) <= difference(max, min);
+    return nonempty & inside;
+  }
+};
+
 /**
  * @brief Check whether value belongs to (min, max).
  *
  * @note To do the check, a value of type 'T' is cast to the bounds type 'U'.
+ * Floats are compared as in float_bits.hpp, so the check fails for NaN even
+ * with fast-math.
  */
 template <typename T, typename U>
 ReturnStatus in_range_open_open(const T& value, const U& min, const U& max) {
-  const auto inside_min = (static_cast<U>(value) > min);
-  const auto inside_max = (static_cast<U>(value) < max);
+  const bool inside =
+      IntervalTest<U>::open_open(static_cast<U>(value), min, max);
   auto comment = CONTRACT_COMMENT("", gcc_7x_to_string_fix(value) +
                                           " must be inside the range (" +
                                           gcc_7x_to_string_fix(min) + ", " +
                                           gcc_7x_to_string_fix(max) + ")");
-  return ReturnStatus(std::move(comment), inside_min && inside_max);
+  return ReturnStatus(std::move(comment), inside);
 }
 
 /**
  * @brief Check whether value belongs to [min, max).
  *
  * @note To do the check, a value of type 'T' is cast to the bounds type 'U'.
+ * Floats are compared as in float_bits.hpp, so the check fails for NaN even
+ * with fast-math.
  */
 template <typename T, typename U>
 ReturnStatus in_range_closed_open(const T& value, const U& min, const U& max) {
-  const auto inside_min = (static_cast<U>(value) >= min);
-  const auto inside_max = (static_cast<U>(value) < max);
+  const bool inside =
+      IntervalTest<U>::closed_open(static_cast<U>(value), min, max);
   auto comment = CONTRACT_COMMENT("", gcc_7x_to_string_fix(value) +
                                           " must be inside the range [" +
                                           gcc_7x_to_string_fix(min) + ", " +
                                           gcc_7x_to_string_fix(max) + ")");
-  return ReturnStatus(std::move(comment), inside_min && inside_max);
+  return ReturnStatus(std::move(comment), inside);
 }
 
 /**
  * @brief Check whether value belongs to (min, max].
  *
  * @note To do the check, a value of type 'T' is cast to the bounds type 'U'.
+ * Floats are compared as in float_bits.hpp, so the check fails for NaN even
+ * with fast-math.
  */
 template <typename T, typename U>
 ReturnStatus in_range_open_closed(const T& value, const U& min, const U& max) {
-  const auto inside_min = (static_cast<U>(value) > min);
-  const auto inside_max = (static_cast<U>(value) <= max);
+  const bool inside =
+      IntervalTest<U>::open_closed(static_cast<U>(value), min, max);
   auto comment = CONTRACT_COMMENT("", gcc_7x_to_string_fix(value) +
                                           " must be inside the range (" +
                                           gcc_7x_to_string_fix(min) + ", " +
                                           gcc_7x_to_string_fix(max) + "]");
-  return ReturnStatus(std::move(comment), inside_min && inside_max);
+  return ReturnStatus(std::move(comment), inside);
 }
 
 /**
  * @brief Check whether value belongs to [min, max].
  *
  * @note To do the check, a value of type 'T' is cast to the bounds type 'U'.
+ * Floats are compared as in float_bits.hpp, so the check fails for NaN even
+ * with fast-math.
  */
 template <typename T, typename U>
 ReturnStatus in_range_closed_closed(const T& value, const U& min,
                                     const U& max) {
-  const auto inside_min = (static_cast<U>(value) >= min);
-  const auto inside_max = (static_cast<U>(value) <= max);
+  const bool inside =
+      IntervalTest<U>::closed_closed(static_cast<U>(value), min, max);
   auto comment = CONTRACT_COMMENT("", gcc_7x_to_string_fix(value) +
                                           " must be inside the range [" +
                                           gcc_7x_to_string_fix(min) + ", " +
                                           gcc_7x_to_string_fix(max) + "]");
-  return ReturnStatus(std::move(comment), inside_min && inside_max);
+  return ReturnStatus(std::move(comment), inside);
 }
 
 }  // namespace range_checks
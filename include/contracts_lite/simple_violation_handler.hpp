@@ -20,12 +20,12 @@
 #ifndef CONTRACTS__SIMPLE_VIOLATION_HANDLER_HPP_
 #define CONTRACTS__SIMPLE_VIOLATION_HANDLER_HPP_
 
+#include <cstdio>
 #include <exception>
-#include <iostream>
 #include <stdexcept>
 #include <string>
 
-#include "contracts_lite/operators.hpp"
+#include "contracts_lite/return_status.hpp"
 
 namespace contracts_lite {
 
@@ -44,7 +44,8 @@ inline void handler_with_continuation(const ContractViolation& violation) {
  */
 inline void handler_without_continuation(
     const ContractViolation& violation) noexcept {
-  std::cerr << "CONTRACT VIOLATION: " << violation << "\n";
+  std::fprintf(stderr, "CONTRACT VIOLATION: %s\n",
+               ContractViolation::string(violation).c_str());
   std::terminate();
 }
 
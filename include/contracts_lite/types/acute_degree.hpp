@@ -21,10 +21,13 @@
 
 #define _USE_MATH_DEFINES
 #include <cmath>
-#include <limits>
+#include <ratio>
 #include <utility>
 
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/niche_traits.hpp"
 #include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
 
 namespace contracts_lite {
 /** @brief Forward declaration for conversion functionality. */
@@ -36,22 +39,24 @@ class AcuteRadian;
  *
  * @note An acute degree is 'valid' if and only if it is in [0, 90).
  *
+ * @note The range check is inherited from BoundedReal; this type adds
+ * conversion from radians.
+ *
  * @invariant The float value of these objects is guaranteed to be valid upon
  * successful construction.
  *
  * @implements{SRD006}
  */
 template <typename T>
-class AcuteDegree {
-  static_assert(std::numeric_limits<T>::is_iec559,
-                "AcuteDegree numeric type must be IEEE float compliant.");
+class AcuteDegree
+    : public BoundedReal<T, std::ratio<0>, std::ratio<90>,
+                         interval::ClosedOpen> {
+  using Base =
+      BoundedReal<T, std::ratio<0>, std::ratio<90>, interval::ClosedOpen>;
 
  public:
   AcuteDegree() = delete;
 
-  /** @brief Allow objects to be directly cast to float types. */
-  operator T() const;
-
   /**
    * @brief Conversion assignment from radians.
    *
@@ -65,6 +70,10 @@ class AcuteDegree {
   /**
    * @brief Conversion constructor from radians.
    *
+   * @note The source object is already valid, so the converted value is
+   * clamped below 90 to absorb rounding rather than being range checked again.
+   * See AcuteDegree(T r, assume_valid_t).
+   *
    * @post See AcuteDegree(T r)
    */
   AcuteDegree(AcuteRadian<T> r);
@@ -77,13 +86,26 @@ class AcuteDegree {
    */
   AcuteDegree(T r);
 
- private:
-  T r_;
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'r'. This is only
+   * enforced at the AUDIT build level.
+   */
+  AcuteDegree(T r, assume_valid_t);
+
+  /** @brief Largest valid value, i.e., the value immediately below 90. */
+  static constexpr T max_value();
 
-  /** @brief Conversion function. */
+ private:
+  /** @brief Conversion function clamped to the valid range. */
   static T radian_to_degree(T r);
 };
 
+/** @brief NaN is outside of the valid range, so it is a niche. */
+template <typename T>
+struct niche_traits<AcuteDegree<T>> : nan_niche_traits<T> {};
+
 }  // namespace contracts_lite
 
 #include "contracts_lite/types/acute_radian.hpp"
@@ -93,29 +115,32 @@ namespace contracts_lite {
 //------------------------------------------------------------------------------
 
 template <typename T>
-T AcuteDegree<T>::radian_to_degree(T r) {
-  constexpr auto ratio = static_cast<T>(180) / static_cast<T>(M_PI);
-  return r * ratio;
+constexpr T AcuteDegree<T>::max_value() {
+  return range_checks::previous_representable(Base::max());
 }
 
 //------------------------------------------------------------------------------
 
 template <typename T>
-AcuteDegree<T>::operator T() const {
-  return r_;
+T AcuteDegree<T>::radian_to_degree(T r) {
+  constexpr auto ratio = static_cast<T>(180) / static_cast<T>(M_PI);
+  constexpr auto max = AcuteDegree<T>::max_value();
+  // Radians just below pi/2 can round up to 90, which is outside of the range.
+  const auto deg = r * ratio;
+  return (deg < max) ? deg : max;
 }
 
 //------------------------------------------------------------------------------
 
 template <typename T>
 AcuteDegree<T>::AcuteDegree(AcuteRadian<T> r)
-    : AcuteDegree<T>(AcuteDegree<T>::radian_to_degree(r)) {}
+    : AcuteDegree<T>(AcuteDegree<T>::radian_to_degree(r), assume_valid) {}
 
 //------------------------------------------------------------------------------
 
 template <typename T>
 AcuteDegree<T>& AcuteDegree<T>::operator=(AcuteRadian<T> r) {
-  *this = AcuteDegree<T>{AcuteDegree<T>::radian_to_degree(r)};
+  *this = AcuteDegree<T>{r};
   return *this;
 }
 
@@ -130,10 +155,12 @@ AcuteDegree<T>& AcuteDegree<T>::operator=(T r) {
 //------------------------------------------------------------------------------
 
 template <typename T>
-AcuteDegree<T>::AcuteDegree(T r) : r_(r) {
-  DEFAULT_ENFORCE(contracts_lite::range_checks::in_range_closed_open(
-      r_, static_cast<T>(0), static_cast<T>(90)));
-}
+AcuteDegree<T>::AcuteDegree(T r) : Base(r) {}
+
+//------------------------------------------------------------------------------
+
+template <typename T>
+AcuteDegree<T>::AcuteDegree(T r, assume_valid_t) : Base(r, assume_valid) {}
 
 //------------------------------------------------------------------------------
 
@@ -21,10 +21,13 @@
 
 #define _USE_MATH_DEFINES
 #include <cmath>
-#include <limits>
+#include <ratio>
 #include <utility>
 
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/niche_traits.hpp"
 #include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
 
 namespace contracts_lite {
 /** @brief Forward declaration for conversion functionality. */
@@ -36,22 +39,24 @@ class AcuteDegree;
  *
  * @note An acute radian is 'valid' if and only if it is in [0, pi/2).
  *
+ * @note The range check is inherited from BoundedReal; this type adds
+ * conversion from degrees.
+ *
  * @invariant The float value of these objects is guaranteed to be valid upon
  * successful construction.
  *
  * @implements{SRD006}
  */
 template <typename T>
-class AcuteRadian {
-  static_assert(std::numeric_limits<T>::is_iec559,
-                "AcuteRadian numeric type must be IEEE float compliant.");
+class AcuteRadian
+    : public BoundedReal<T, std::ratio<0>, bounds::HalfPi,
+                         interval::ClosedOpen> {
+  using Base =
+      BoundedReal<T, std::ratio<0>, bounds::HalfPi, interval::ClosedOpen>;
 
  public:
   AcuteRadian() = delete;
 
-  /** @brief Allow objects to be directly cast to float types. */
-  operator T() const;
-
   /**
    * @brief Conversion assignment from degrees.
    *
@@ -65,6 +70,10 @@ class AcuteRadian {
   /**
    * @brief Conversion constructor from degrees.
    *
+   * @note The source object is already valid, so the converted value is
+   * clamped below pi/2 to absorb rounding rather than being range checked
+   * again. See AcuteRadian(T r, assume_valid_t).
+   *
    * @post See AcuteRadian(T r)
    */
   AcuteRadian(AcuteDegree<T> r);
@@ -77,13 +86,26 @@ class AcuteRadian {
    */
   AcuteRadian(T r);
 
- private:
-  T r_;
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'r'. This is only
+   * enforced at the AUDIT build level.
+   */
+  AcuteRadian(T r, assume_valid_t);
+
+  /** @brief Largest valid value, i.e., the value immediately below pi/2. */
+  static constexpr T max_value();
 
-  /** @brief Conversion function. */
+ private:
+  /** @brief Conversion function clamped to the valid range. */
   static T degree_to_radian(T r);
 };
 
+/** @brief NaN is outside of the valid range, so it is a niche. */
+template <typename T>
+struct niche_traits<AcuteRadian<T>> : nan_niche_traits<T> {};
+
 }  // namespace contracts_lite
 
 #include "contracts_lite/types/acute_degree.hpp"
@@ -93,29 +115,32 @@ namespace contracts_lite {
 //------------------------------------------------------------------------------
 
 template <typename T>
-T AcuteRadian<T>::degree_to_radian(T r) {
-  constexpr auto ratio = static_cast<T>(M_PI) / static_cast<T>(180);
-  return r * ratio;
+constexpr T AcuteRadian<T>::max_value() {
+  return range_checks::previous_representable(Base::max());
 }
 
 //------------------------------------------------------------------------------
 
 template <typename T>
-AcuteRadian<T>::operator T() const {
-  return r_;
+T AcuteRadian<T>::degree_to_radian(T r) {
+  constexpr auto ratio = static_cast<T>(M_PI) / static_cast<T>(180);
+  constexpr auto max = AcuteRadian<T>::max_value();
+  // Degrees just below 90 can round up to pi/2, which is outside of the range.
+  const auto rad = r * ratio;
+  return (rad < max) ? rad : max;
 }
 
 //------------------------------------------------------------------------------
 
 template <typename T>
 AcuteRadian<T>::AcuteRadian(AcuteDegree<T> r)
-    : AcuteRadian<T>(AcuteRadian<T>::degree_to_radian(r)) {}
+    : AcuteRadian<T>(AcuteRadian<T>::degree_to_radian(r), assume_valid) {}
 
 //------------------------------------------------------------------------------
 
 template <typename T>
 AcuteRadian<T>& AcuteRadian<T>::operator=(AcuteDegree<T> d) {
-  *this = AcuteRadian<T>{AcuteRadian<T>::degree_to_radian(d)};
+  *this = AcuteRadian<T>{d};
   return *this;
 }
 
@@ -130,10 +155,12 @@ AcuteRadian<T>& AcuteRadian<T>::operator=(T r) {
 //------------------------------------------------------------------------------
 
 template <typename T>
-AcuteRadian<T>::AcuteRadian(T r) : r_(r) {
-  DEFAULT_ENFORCE(contracts_lite::range_checks::in_range_closed_open(
-      r_, static_cast<T>(0), static_cast<T>(M_PI * 0.5)));
-}
+AcuteRadian<T>::AcuteRadian(T r) : Base(r) {}
+
+//------------------------------------------------------------------------------
+
+template <typename T>
+AcuteRadian<T>::AcuteRadian(T r, assume_valid_t) : Base(r, assume_valid) {}
 
 //------------------------------------------------------------------------------
 
@@ -0,0 +1,332 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines trigonometric functions of acute angles.
+
+#ifndef CONTRACTS__ACUTE_TRIG_HPP_
+#define CONTRACTS__ACUTE_TRIG_HPP_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "contracts_lite/types/acute_degree.hpp"
+#include "contracts_lite/types/acute_radian.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Polynomial kernels and argument reduction for acute angles.
+ * @note INTERNAL USE ONLY
+ */
+namespace acute_trig_detail {
+
+/**
+ * @brief An acute angle reduced to [0, pi/4] in radians, as the sum of 'y' and
+ * a much smaller 'tail'. If 'reflected', the angle was x > pi/4 and the
+ * reduced angle is pi/2 - x, so sin(x) = cos(y) and vice versa.
+ */
+struct Reduced {
+  double y;
+  double tail;
+  bool reflected;
+};
+
+/**
+ * @brief Reduce 'x' in [0, pi/2). For x in [pi/4, pi/2), pi/2 is split into a
+ * leading part, from which 'x' is subtracted exactly (Sterbenz), and a
+ * trailing part. Their sum is kept as 'y' plus its rounding error, so the
+ * reduced angle is accurate even as x nears pi/2.
+ */
+inline Reduced reduce_radian(double x) {
+  constexpr double pio2_hi = 1.57079632679489655800e+00;
+  constexpr double pio2_lo = 6.12323399573676603587e-17;
+  constexpr double pio4 = 7.85398163397448278999e-01;
+  const bool reflected = (x > pio4);
+  const double hi = pio2_hi - x;
+  const double y = hi + pio2_lo;
+  const double tail = pio2_lo - (y - hi);
+  return Reduced{reflected ? y : x, reflected ? tail : 0.0, reflected};
+}
+
+/**
+ * @brief Split 'x' into a high part with at most 26 significant bits and the
+ * rest (Veltkamp), so that products of high parts are exact.
+ */
+constexpr double split_high(double x) {
+  return 134217729.0 * x - (134217729.0 * x - x);
+}
+
+/**
+ * @brief Reduce 'd' in [0, 90) degrees. The reflection 90 - d is exact, and
+ * the conversion to radians keeps the rounding error of the product (Dekker)
+ * and of pi/180 itself as the tail.
+ */
+inline Reduced reduce_degree(double d) {
+  constexpr double k = 1.74532925199432954744e-02;
+  constexpr double k_lo = 2.94865227087016868684e-19;
+  constexpr double k_hi_part = split_high(k);
+  constexpr double k_lo_part = k - k_hi_part;
+  const bool reflected = (d > 45.0);
+  const double e = reflected ? 90.0 - d : d;
+  const double e_hi_part = split_high(e);
+  const double e_lo_part = e - e_hi_part;
+  const double y = e * k;
+  const double error = ((e_hi_part * k_hi_part - y) + e_hi_part * k_lo_part +
+                        e_lo_part * k_hi_part) +
+                       e_lo_part * k_lo_part;
+  return Reduced{y, error + e * k_lo, reflected};
+}
+
+/**
+ * @brief Minimax kernels on [0, pi/4], selected by the result type.
+ *
+ * The double kernels are those of fdlibm (k_sin.c, k_cos.c), with errors below
+ * 2^-58 relative to the result, including the correction for the tail of the
+ * reduced angle. The float kernels are those of FreeBSD's k_sinf.c, k_cosf.c
+ * and k_tanf.c, evaluated in double so that their errors (below 2^-25) are
+ * well under half an ulp of the float result; they ignore the tail.
+ */
+template <typename T>
+struct Kernels;
+
+template <>
+struct Kernels<double> {
+  static double sin(double x, double tail) {
+    constexpr double s1 = -1.66666666666666324348e-01;
+    constexpr double s2 = 8.33333333332248946124e-03;
+    constexpr double s3 = -1.98412698298579493134e-04;
+    constexpr double s4 = 2.75573137070700676789e-06;
+    constexpr double s5 = -2.50507602534068634195e-08;
+    constexpr double s6 = 1.58969099521155010221e-10;
+    const double z = x * x;
+    const double w = z * z;
+    const double r = s2 + z * (s3 + z * s4) + z * w * (s5 + z * s6);
+    const double v = z * x;
+    return x - ((z * (0.5 * tail - v * r) - tail) - v * s1);
+  }
+
+  static double cos(double x, double tail) {
+    constexpr double c1 = 4.16666666666666019037e-02;
+    constexpr double c2 = -1.38888888888741095749e-03;
+    constexpr double c3 = 2.48015872894767294178e-05;
+    constexpr double c4 = -2.75573143513906633035e-07;
+    constexpr double c5 = 2.08757232129817482790e-09;
+    constexpr double c6 = -1.13596475577881948265e-11;
+    const double z = x * x;
+    const double w = z * z;
+    const double r =
+        z * (c1 + z * (c2 + z * c3)) + w * w * (c4 + z * (c5 + z * c6));
+    // 1 - z/2 is rounded, so its rounding error is added back in.
+    const double hz = 0.5 * z;
+    const double v = 1.0 - hz;
+    return v + (((1.0 - v) - hz) + (z * r - x * tail));
+  }
+
+  /** @brief tan(y), or cot(y) if 'reflected'. */
+  static double tan(double y, double tail, bool reflected) {
+    const double s = Kernels::sin(y, tail);
+    const double c = Kernels::cos(y, tail);
+    return reflected ? c / s : s / c;
+  }
+};
+
+template <>
+struct Kernels<float> {
+  static double sin(double x, double) {
+    constexpr double s1 = -0.166666666416265235595;
+    constexpr double s2 = 0.0083333293858894631756;
+    constexpr double s3 = -0.000198393348360966317347;
+    constexpr double s4 = 0.0000027183114939898219064;
+    const double z = x * x;
+    const double w = z * z;
+    const double s = z * x;
+    return (x + s * (s1 + z * s2)) + s * w * (s3 + z * s4);
+  }
+
+  static double cos(double x, double) {
+    constexpr double c0 = -0.499999997251031003120;
+    constexpr double c1 = 0.0416666233237390631894;
+    constexpr double c2 = -0.00138867637746099294692;
+    constexpr double c3 = 0.0000243904487962774090654;
+    const double z = x * x;
+    const double w = z * z;
+    return ((1.0 + z * c0) + w * c1) + (w * z) * (c2 + z * c3);
+  }
+
+  /** @brief tan(y), or cot(y) if 'reflected'. */
+  static double tan(double y, double, bool reflected) {
+    constexpr double t0 = 0.333331395030791399758;
+    constexpr double t1 = 0.133392002712976742718;
+    constexpr double t2 = 0.0533812378445670393523;
+    constexpr double t3 = 0.0245283181166547278873;
+    constexpr double t4 = 0.00297435743359967304927;
+    constexpr double t5 = 0.00946564784943673166728;
+    const double z = y * y;
+    const double w = z * z;
+    const double s = z * y;
+    const double t = (y + s * (t0 + z * t1)) +
+                     (s * w) * ((t2 + z * t3) + w * (t4 + z * t5));
+    return reflected ? 1.0 / t : t;
+  }
+};
+
+template <typename T>
+T sin(Reduced r) {
+  // Both kernels are evaluated so that batch loops have no branches.
+  const double s = Kernels<T>::sin(r.y, r.tail);
+  const double c = Kernels<T>::cos(r.y, r.tail);
+  return static_cast<T>(r.reflected ? c : s);
+}
+
+template <typename T>
+T cos(Reduced r) {
+  const double s = Kernels<T>::sin(r.y, r.tail);
+  const double c = Kernels<T>::cos(r.y, r.tail);
+  return static_cast<T>(r.reflected ? s : c);
+}
+
+template <typename T>
+T tan(Reduced r) {
+  return static_cast<T>(Kernels<T>::tan(r.y, r.tail, r.reflected));
+}
+
+}  // namespace acute_trig_detail
+
+/** @brief Sine and cosine of the same angle. */
+template <typename T>
+struct SinCos {
+  T sin;
+  T cos;
+};
+
+/**
+ * @brief Trigonometric functions of acute angles.
+ *
+ * Since the argument is known to be in [0, pi/2), these skip the general range
+ * reduction and the handling of NaN and infinity of std::sin, std::cos and
+ * std::tan. The argument is reflected into [0, pi/4] if needed and evaluated
+ * with branch-free minimax polynomials, so the batch versions vectorize.
+ *
+ * Maximum errors, measured against long double references over the whole
+ * domain (see test_acute_trig.cpp), are below 1 ulp for sin, cos and tan in
+ * float and for sin and cos in double, and below 2.5 ulp for tan in double,
+ * which is computed as a quotient. Degrees are reflected into [0, 45] exactly
+ * and converted to radians with the rounding error kept, so they have the
+ * same bounds.
+ *
+ * @note Only float and double are supported. With -ffast-math, the compiler
+ * may simplify away the rounding errors kept for double, so the errors of
+ * double may exceed these bounds.
+ */
+template <typename T>
+T sin(AcuteRadian<T> x) {
+  return acute_trig_detail::sin<T>(acute_trig_detail::reduce_radian(x));
+}
+
+/** @brief See sin(AcuteRadian<T>). */
+template <typename T>
+T cos(AcuteRadian<T> x) {
+  return acute_trig_detail::cos<T>(acute_trig_detail::reduce_radian(x));
+}
+
+/** @brief See sin(AcuteRadian<T>). The result is finite. */
+template <typename T>
+T tan(AcuteRadian<T> x) {
+  return acute_trig_detail::tan<T>(acute_trig_detail::reduce_radian(x));
+}
+
+/** @brief See sin(AcuteRadian<T>). The argument is reduced once. */
+template <typename T>
+SinCos<T> sincos(AcuteRadian<T> x) {
+  const auto r = acute_trig_detail::reduce_radian(x);
+  const double s = acute_trig_detail::Kernels<T>::sin(r.y, r.tail);
+  const double c = acute_trig_detail::Kernels<T>::cos(r.y, r.tail);
+  return SinCos<T>{static_cast<T>(r.reflected ? c : s),
+                   static_cast<T>(r.reflected ? s : c)};
+}
+
+/** @brief See sin(AcuteRadian<T>). */
+template <typename T>
+T sin(AcuteDegree<T> d) {
+  return acute_trig_detail::sin<T>(acute_trig_detail::reduce_degree(d));
+}
+
+/** @brief See sin(AcuteRadian<T>). */
+template <typename T>
+T cos(AcuteDegree<T> d) {
+  return acute_trig_detail::cos<T>(acute_trig_detail::reduce_degree(d));
+}
+
+/** @brief See sin(AcuteRadian<T>). The result is finite. */
+template <typename T>
+T tan(AcuteDegree<T> d) {
+  return acute_trig_detail::tan<T>(acute_trig_detail::reduce_degree(d));
+}
+
+/** @brief See sin(AcuteRadian<T>). The argument is reduced once. */
+template <typename T>
+SinCos<T> sincos(AcuteDegree<T> d) {
+  const auto r = acute_trig_detail::reduce_degree(d);
+  const double s = acute_trig_detail::Kernels<T>::sin(r.y, r.tail);
+  const double c = acute_trig_detail::Kernels<T>::cos(r.y, r.tail);
+  return SinCos<T>{static_cast<T>(r.reflected ? c : s),
+                   static_cast<T>(r.reflected ? s : c)};
+}
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Batch versions: apply the function to the 'n' angles in 'x', writing
+ * the results to 'out' (or 'sin_out' and 'cos_out'). 'A' is AcuteRadian<T> or
+ * AcuteDegree<T>, which have the same layout as 'T'.
+ */
+template <typename A>
+void sin_batch(const A* x, std::size_t n, typename A::value_type* out) {
+  for (std::size_t i = 0; i < n; ++i) {
+    out[i] = sin(x[i]);
+  }
+}
+
+/** @brief See sin_batch. */
+template <typename A>
+void cos_batch(const A* x, std::size_t n, typename A::value_type* out) {
+  for (std::size_t i = 0; i < n; ++i) {
+    out[i] = cos(x[i]);
+  }
+}
+
+/** @brief See sin_batch. */
+template <typename A>
+void tan_batch(const A* x, std::size_t n, typename A::value_type* out) {
+  for (std::size_t i = 0; i < n; ++i) {
+    out[i] = tan(x[i]);
+  }
+}
+
+/** @brief See sin_batch. */
+template <typename A>
+void sincos_batch(const A* x, std::size_t n, typename A::value_type* sin_out,
+                  typename A::value_type* cos_out) {
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto sc = sincos(x[i]);
+    sin_out[i] = sc.sin;
+    cos_out[i] = sc.cos;
+  }
+}
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__ACUTE_TRIG_HPP_
@@ -0,0 +1,266 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines the generic bounded real type.
+
+#ifndef CONTRACTS__BOUNDED_REAL_HPP_
+#define CONTRACTS__BOUNDED_REAL_HPP_
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/float16.hpp"
+#include "contracts_lite/float_bits.hpp"
+#include "contracts_lite/niche_traits.hpp"
+#include "contracts_lite/range_checks.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Compile-time bounds for use with BoundedReal.
+ *
+ * A bound is either a std::ratio or a type providing a static constexpr
+ * function template 'value<T>()' returning the bound in numeric type 'T'.
+ */
+namespace bounds {
+
+/** @brief Positive infinity. */
+struct Infinity {
+  template <typename T>
+  static constexpr T value() {
+    return std::numeric_limits<T>::infinity();
+  }
+};
+
+/** @brief Negative infinity. */
+struct NegativeInfinity {
+  template <typename T>
+  static constexpr T value() {
+    return -std::numeric_limits<T>::infinity();
+  }
+};
+
+/** @brief A quarter turn in radians, i.e., pi/2 rounded to 'T'. */
+struct HalfPi {
+  template <typename T>
+  static constexpr T value() {
+    return static_cast<T>(M_PI * 0.5);
+  }
+};
+
+/** @brief Get the value of bound 'B' in numeric type 'T'. */
+template <typename T, typename B>
+struct value_of {
+  static constexpr T value() { return B::template value<T>(); }
+};
+
+/** @brief Get the value of a ratio bound in numeric type 'T'. */
+template <typename T, std::intmax_t N, std::intmax_t D>
+struct value_of<T, std::ratio<N, D>> {
+  static constexpr T value() {
+    return static_cast<T>(std::ratio<N, D>::num) /
+           static_cast<T>(std::ratio<N, D>::den);
+  }
+};
+
+/**
+ * @brief Get the value of a ratio bound as a 16-bit float, dividing in double
+ * and rounding once.
+ */
+template <int E, std::intmax_t N, std::intmax_t D>
+struct value_of<Binary16<E>, std::ratio<N, D>> {
+  static constexpr Binary16<E> value() {
+    return Binary16<E>(static_cast<double>(std::ratio<N, D>::num) /
+                       static_cast<double>(std::ratio<N, D>::den));
+  }
+};
+
+}  // namespace bounds
+
+/**
+ * @brief Interval kinds for use with BoundedReal.
+ *
+ * Each kind provides a plain predicate 'contains' and a 'check' that returns a
+ * ReturnStatus for enforcement (see range_checks.hpp). Both compare as in
+ * float_bits.hpp, so NaN and infinities are detected even with fast-math, and
+ * neither has a branch (see range_checks::IntervalTest), so loops of
+ * 'contains' vectorize (see batch_enforcement.hpp).
+ */
+namespace interval {
+
+/** @brief The interval (min, max). */
+struct OpenOpen {
+  template <typename T>
+  static constexpr bool contains(T value, T min, T max) {
+    return range_checks::IntervalTest<T>::open_open(value, min, max);
+  }
+  template <typename T>
+  static ReturnStatus check(T value, T min, T max) {
+    return range_checks::in_range_open_open(value, min, max);
+  }
+};
+
+/** @brief The interval [min, max). */
+struct ClosedOpen {
+  template <typename T>
+  static constexpr bool contains(T value, T min, T max) {
+    return range_checks::IntervalTest<T>::closed_open(value, min, max);
+  }
+  template <typename T>
+  static ReturnStatus check(T value, T min, T max) {
+    return range_checks::in_range_closed_open(value, min, max);
+  }
+};
+
+/** @brief The interval (min, max]. */
+struct OpenClosed {
+  template <typename T>
+  static constexpr bool contains(T value, T min, T max) {
+    return range_checks::IntervalTest<T>::open_closed(value, min, max);
+  }
+  template <typename T>
+  static ReturnStatus check(T value, T min, T max) {
+    return range_checks::in_range_open_closed(value, min, max);
+  }
+};
+
+/** @brief The interval [min, max]. */
+struct ClosedClosed {
+  template <typename T>
+  static constexpr bool contains(T value, T min, T max) {
+    return range_checks::IntervalTest<T>::closed_closed(value, min, max);
+  }
+  template <typename T>
+  static ReturnStatus check(T value, T min, T max) {
+    return range_checks::in_range_closed_closed(value, min, max);
+  }
+};
+
+}  // namespace interval
+
+/**
+ * @brief Container for reals restricted to an interval fixed at compile time.
+ *
+ * @note A bounded real is 'valid' if and only if it is in the interval of kind
+ * 'Interval' (see the interval namespace) with lower bound 'Lo' and upper bound
+ * 'Hi' (see the bounds namespace). Since the bounds are constant expressions,
+ * the check compiles to comparisons against constants.
+ *
+ * @invariant The float value of these objects is guaranteed to be valid upon
+ * successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, typename Lo, typename Hi, typename Interval>
+class BoundedReal {
+  static_assert(float_bits::has_ieee_layout<T>::value,
+                "BoundedReal numeric type must be IEEE float compliant.");
+
+ public:
+  using value_type = T;
+  using lower_bound = Lo;
+  using upper_bound = Hi;
+  using interval_type = Interval;
+
+  BoundedReal() = delete;
+
+  /** @brief Allow objects to be directly cast to float types. */
+  operator T() const { return r_; }
+
+  /**
+   * @brief Converting constructor for valid bounded real objects.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * BoundedReal).
+   */
+  BoundedReal(T r) : r_(r) { DEFAULT_ENFORCE(BoundedReal::check(r_)); }
+
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'r'. This is only
+   * enforced at the AUDIT build level.
+   */
+  BoundedReal(T r, assume_valid_t) : r_(r) {
+    AUDIT_ENFORCE(BoundedReal::check(r_));
+  }
+
+  /** @brief The lower bound of the interval. */
+  static constexpr T min() { return bounds::value_of<T, Lo>::value(); }
+
+  /** @brief The upper bound of the interval. */
+  static constexpr T max() { return bounds::value_of<T, Hi>::value(); }
+
+  /** @brief Predicate for the class invariant. */
+  static constexpr bool is_valid(T r) {
+    return Interval::contains(r, BoundedReal::min(), BoundedReal::max());
+  }
+
+  /** @brief Range check enforcing the class invariant. */
+  static ReturnStatus check(T r) {
+    return Interval::check(r, BoundedReal::min(), BoundedReal::max());
+  }
+
+  /**
+   * @brief Check the class invariant for the 'count' values in 'data'.
+   *
+   * This is meant for validating external buffers, e.g., before constructing
+   * objects from them with the trusted constructor. For 16-bit floats, the
+   * loop works on the bits without branches, and vectorizes at -O3.
+   */
+  static ReturnStatus check_batch(const T* data, std::size_t count) {
+    // Compilers vectorize an integer accumulator, but not a bool.
+    unsigned all_valid = 1u;
+    for (std::size_t i = 0; i < count; ++i) {
+      all_valid &= static_cast<unsigned>(BoundedReal::is_valid(data[i]));
+    }
+    const bool valid = (all_valid != 0u);
+    auto comment = CONTRACT_COMMENT(
+        "", valid ? std::string()
+                  : (std::to_string(count) + " bounded reals must be valid"));
+    return ReturnStatus(std::move(comment), valid);
+  }
+
+ private:
+  T r_;
+};
+
+/**
+ * @brief Convert 'x' to a bounded real of numeric type 'U' on the same
+ * interval, e.g., from float16 to float or back.
+ *
+ * @post The result is checked as by the converting constructor, since the
+ * value can round out of the interval, e.g., to infinity or zero when
+ * narrowing to float16, and the bounds themselves round differently in 'U'.
+ */
+template <typename U, typename T, typename Lo, typename Hi, typename Interval>
+BoundedReal<U, Lo, Hi, Interval> real_cast(
+    const BoundedReal<T, Lo, Hi, Interval>& x) {
+  return BoundedReal<U, Lo, Hi, Interval>(static_cast<U>(static_cast<T>(x)));
+}
+
+/** @brief NaN is outside of every interval, so it is a niche of BoundedReal. */
+template <typename T, typename Lo, typename Hi, typename Interval>
+struct niche_traits<BoundedReal<T, Lo, Hi, Interval>> : nan_niche_traits<T> {};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__BOUNDED_REAL_HPP_
@@ -0,0 +1,273 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines a fixed-capacity vector with inline storage.
+
+#ifndef CONTRACTS__BOUNDED_VECTOR_HPP_
+#define CONTRACTS__BOUNDED_VECTOR_HPP_
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Vector of at most 'N' elements, stored inline without allocating.
+ *
+ * The size is a SizeBound<N>, so the class invariant size() <= N is the
+ * invariant of the size type. Operations that grow or shrink the vector
+ * check the new size before touching any element: if it is out of range, the
+ * violation is reported at the DEFAULT build level, and if the violation
+ * handler returns, the vector is left unchanged.
+ *
+ * @note Since size() <= N always holds, iterating over [begin(), end()) never
+ * leaves the storage, and element access by index is only checked against the
+ * size at the AUDIT build level, like the other unchecked accessors in this
+ * library.
+ *
+ * @invariant The size of these objects is guaranteed to be valid after each
+ * successful operation.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, std::size_t N>
+class BoundedVector {
+  static_assert(N > 0, "Bounded vector must have a positive capacity.");
+
+ public:
+  using value_type = T;
+  using size_type = SizeBound<N>;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  BoundedVector() : size_(0, assume_valid) {}
+
+  /**
+   * @brief Construct a vector with the elements of 'init'.
+   *
+   * @pre 'init' has at most 'N' elements. This is enforced at the DEFAULT
+   * build level.
+   */
+  BoundedVector(std::initializer_list<T> init) : size_(0, assume_valid) {
+    if (!enforce_size(init.size())) {
+      return;
+    }
+    std::size_t i = 0;
+    for (const auto& value : init) {
+      new (slot(i++)) T(value);
+    }
+    size_ = size_type(i, assume_valid);
+  }
+
+  BoundedVector(const BoundedVector& other) : size_(other.size_) {
+    for (std::size_t i = 0; i < size_; ++i) {
+      new (slot(i)) T(other[i]);
+    }
+  }
+
+  BoundedVector(BoundedVector&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value)
+      : size_(other.size_) {
+    for (std::size_t i = 0; i < size_; ++i) {
+      new (slot(i)) T(std::move(other[i]));
+    }
+  }
+
+  BoundedVector& operator=(const BoundedVector& other) {
+    if (this != &other) {
+      clear();
+      for (std::size_t i = 0; i < other.size_; ++i) {
+        new (slot(i)) T(other[i]);
+      }
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  BoundedVector& operator=(BoundedVector&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      clear();
+      for (std::size_t i = 0; i < other.size_; ++i) {
+        new (slot(i)) T(std::move(other[i]));
+      }
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  ~BoundedVector() { clear(); }
+
+  /** @brief The number of elements. */
+  size_type size() const { return size_; }
+
+  /** @brief The maximum number of elements. */
+  static constexpr std::size_t capacity() { return N; }
+
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == N; }
+
+  /**
+   * @brief Append an element.
+   *
+   * @pre The vector is not full. This is enforced at the DEFAULT build level.
+   */
+  void push_back(const T& value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  /**
+   * @brief Construct an element in place at the end.
+   *
+   * @pre The vector is not full. This is enforced at the DEFAULT build level.
+   * If the violation handler returns, nothing is constructed and the last
+   * element is returned.
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    // Keep the new size as a plain integer until the element is constructed.
+    // A SizeBound local stored across the write would be kept in memory,
+    // which also forces size_ to be reloaded after each element.
+    const std::size_t new_size = size_ + 1;
+    if (!enforce_size(new_size)) {
+      return data()[size_ - 1];
+    }
+    T* element = new (slot(size_)) T(std::forward<Args>(args)...);
+    size_ = size_type(new_size, assume_valid);
+    return *element;
+  }
+
+  /**
+   * @brief Remove the last element.
+   *
+   * @pre The vector is not empty. This is enforced at the DEFAULT build level.
+   */
+  void pop_back() {
+    // On an empty vector, the new size wraps around and fails its check.
+    const std::size_t new_size = size_ - 1;
+    if (!enforce_size(new_size)) {
+      return;
+    }
+    data()[new_size].~T();
+    size_ = size_type(new_size, assume_valid);
+  }
+
+  /**
+   * @brief Resize to 'n' elements, default constructing new elements.
+   *
+   * @pre 'n' is at most 'N'. This is enforced at the DEFAULT build level.
+   */
+  void resize(std::size_t n) { resize_impl(n, [](void* p) { new (p) T(); }); }
+
+  /**
+   * @brief Resize to 'n' elements, copying 'value' into new elements.
+   *
+   * @pre 'n' is at most 'N'. This is enforced at the DEFAULT build level.
+   */
+  void resize(std::size_t n, const T& value) {
+    resize_impl(n, [&value](void* p) { new (p) T(value); });
+  }
+
+  /** @brief Remove all elements. */
+  void clear() {
+    for (std::size_t i = size_; i > 0; --i) {
+      data()[i - 1].~T();
+    }
+    size_ = size_type(0, assume_valid);
+  }
+
+  /**
+   * @brief Element 'i'.
+   *
+   * @pre 'i' is less than size(). This is enforced at the AUDIT build level.
+   */
+  T& operator[](std::size_t i) {
+    AUDIT_ENFORCE(BoundedVector::check_index(i));
+    return data()[i];
+  }
+  const T& operator[](std::size_t i) const {
+    AUDIT_ENFORCE(BoundedVector::check_index(i));
+    return data()[i];
+  }
+
+  T& front() { return (*this)[0]; }
+  const T& front() const { return (*this)[0]; }
+  T& back() { return (*this)[size_ - 1]; }
+  const T& back() const { return (*this)[size_ - 1]; }
+
+  T* data() { return reinterpret_cast<T*>(storage_); }
+  const T* data() const { return reinterpret_cast<const T*>(storage_); }
+
+  iterator begin() { return data(); }
+  iterator end() { return data() + size_; }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data() + size_; }
+
+  /** @brief Check that 'i' is the index of an element. */
+  ReturnStatus check_index(std::size_t i) const {
+    return range_checks::in_range_closed_open(i, static_cast<std::size_t>(0),
+                                              static_cast<std::size_t>(size_));
+  }
+
+ private:
+  void* slot(std::size_t i) { return &storage_[i]; }
+
+  /**
+   * @brief Whether 'n' is a valid size, which is enforced at the DEFAULT build
+   * level. If the check fails and the violation handler returns, this is
+   * false, and the caller leaves the vector unchanged. At build levels that do
+   * not enforce the check, it is not evaluated and this is true.
+   */
+  static bool enforce_size(std::size_t n) {
+    static_cast<void>(n);  // Unused at build levels that do not enforce it.
+    bool valid = true;
+    DEFAULT_ENFORCE([&]() {
+      ReturnStatus status = size_type::check(n);
+      valid = status.status;
+      return status;
+    }());
+    return valid;
+  }
+
+  template <typename Construct>
+  void resize_impl(std::size_t n, Construct construct) {
+    if (!enforce_size(n)) {
+      return;
+    }
+    for (std::size_t i = size_; i > n; --i) {
+      data()[i - 1].~T();
+    }
+    for (std::size_t i = size_; i < n; ++i) {
+      construct(slot(i));
+      // Keep the constructed elements owned if a later construction throws.
+      size_ = size_type(i + 1, assume_valid);
+    }
+    size_ = size_type(n, assume_valid);
+  }
+
+  size_type size_;
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_[N];
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__BOUNDED_VECTOR_HPP_
@@ -0,0 +1,262 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines the covariance matrix type.
+
+#ifndef CONTRACTS__COVARIANCE_MATRIX_HPP_
+#define CONTRACTS__COVARIANCE_MATRIX_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "contracts_lite/array_checks.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Container for N x N covariance matrices, stored in row-major order.
+ *
+ * @note A covariance matrix is 'valid' if and only if it is symmetric and
+ * positive semidefinite, to within a tolerance relative to its largest
+ * diagonal entry (see tolerance()). This is checked with a Cholesky
+ * factorization, which costs O(N^3).
+ *
+ * Since the invariant holds for the lifetime of an object, functions taking a
+ * CovarianceMatrix don't need to re-check it: the check runs once when a
+ * matrix is constructed, and once each time it is modified through modify().
+ * Const access never invalidates it.
+ *
+ * @invariant The entries of these objects are guaranteed to be valid after
+ * each successful construction or modification.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, std::size_t N>
+class CovarianceMatrix {
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "Covariance matrix numeric type must be IEEE float "
+                "compliant.");
+  static_assert(N > 0, "Covariance matrix must have a positive dimension.");
+
+ public:
+  using value_type = T;
+  using array_type = std::array<T, N * N>;
+
+  CovarianceMatrix() = delete;
+
+  /**
+   * @brief Constructor for valid covariance matrix objects from the entries in
+   * row-major order.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * CovarianceMatrix).
+   */
+  explicit CovarianceMatrix(const array_type& m) : m_(m) {
+    DEFAULT_ENFORCE(CovarianceMatrix::check(m_));
+  }
+
+  /**
+   * @brief Trusted constructor for entries already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'm'. This is only
+   * enforced at the AUDIT build level.
+   */
+  CovarianceMatrix(const array_type& m, assume_valid_t) : m_(m) {
+    AUDIT_ENFORCE(CovarianceMatrix::check(m_));
+  }
+
+  /** @brief Diagonal covariance matrix with all variances equal to 'v'. */
+  static CovarianceMatrix isotropic(T variance) {
+    array_type m{};
+    for (std::size_t i = 0; i < N; ++i) {
+      m[N * i + i] = variance;
+    }
+    return CovarianceMatrix(m);
+  }
+
+  /** @brief Entry at row 'i' and column 'j'. */
+  T operator()(std::size_t i, std::size_t j) const { return m_[N * i + j]; }
+
+  /** @brief The entries in row-major order. */
+  const array_type& array() const { return m_; }
+
+  /**
+   * @brief Modify the entries with 'f', which is called with a mutable
+   * reference to a copy of them, and re-check the class invariant.
+   *
+   * If the check fails and the violation handler returns or throws, this
+   * object is unchanged.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * CovarianceMatrix).
+   */
+  template <typename F>
+  void modify(F f) {
+    array_type m = m_;
+    f(m);
+    // At build levels that do not enforce the check, it is not evaluated and
+    // 'm' is assigned unconditionally.
+    bool valid = true;
+    DEFAULT_ENFORCE([&]() {
+      ReturnStatus status = CovarianceMatrix::check(m);
+      valid = status.status;
+      return status;
+    }());
+    if (valid) {
+      m_ = m;
+    }
+  }
+
+  /**
+   * @brief Sum of covariance matrices.
+   *
+   * Sums of PSD matrices are PSD, but large entries can overflow to inf, so
+   * the diagonal of the sum is checked to be finite.
+   */
+  CovarianceMatrix operator+(const CovarianceMatrix& other) const {
+    array_type m;
+    for (std::size_t k = 0; k < N * N; ++k) {
+      m[k] = m_[k] + other.m_[k];
+    }
+    DEFAULT_ENFORCE(CovarianceMatrix::check_finite(m));
+    return CovarianceMatrix(m, assume_valid);
+  }
+
+  /**
+   * @brief Tolerance on symmetry and on the Cholesky pivots, relative to the
+   * largest diagonal entry.
+   */
+  static constexpr T tolerance() {
+    return static_cast<T>(16 * N) * std::numeric_limits<T>::epsilon();
+  }
+
+  /** @brief Predicate for the class invariant. */
+  static bool is_valid(const array_type& m) {
+    const auto tol = absolute_tolerance(m);
+    return is_finite(tol) && is_symmetric(m, tol) &&
+           is_positive_semidefinite(m, tol);
+  }
+
+  /** @brief Check enforcing the class invariant. */
+  static ReturnStatus check(const array_type& m) {
+    const auto tol = absolute_tolerance(m);
+    const bool symmetric = is_finite(tol) && is_symmetric(m, tol);
+    const bool psd = symmetric && is_positive_semidefinite(m, tol);
+    auto comment = CONTRACT_COMMENT(
+        "", std::to_string(N) + "x" + std::to_string(N) +
+                " covariance matrix must be symmetric (" +
+                (symmetric ? "true" : "false") +
+                ") and positive semidefinite (" + (psd ? "true" : "false") +
+                ") within " + gcc_7x_to_string_fix(tol));
+    return ReturnStatus(std::move(comment), psd);
+  }
+
+ private:
+  /**
+   * @brief Tolerance scaled by the largest diagonal entry. This is NaN if a
+   * diagonal entry is NaN, which fails every comparison below.
+   */
+  static T absolute_tolerance(const array_type& m) {
+    T max_diagonal = static_cast<T>(0);
+    for (std::size_t i = 0; i < N; ++i) {
+      const auto d = m[N * i + i];
+      max_diagonal = (d > max_diagonal || d != d) ? d : max_diagonal;
+    }
+    return tolerance() * max_diagonal;
+  }
+
+  /** @brief Check that no diagonal entry is inf or NaN. */
+  static ReturnStatus check_finite(const array_type& m) {
+    const auto tol = absolute_tolerance(m);
+    auto comment = CONTRACT_COMMENT(
+        "", std::to_string(N) + "x" + std::to_string(N) +
+                " covariance matrix must have a finite diagonal, but the "
+                "tolerance is " +
+                gcc_7x_to_string_fix(tol));
+    return ReturnStatus(std::move(comment), is_finite(tol));
+  }
+
+  /** @brief Whether 'tol' is finite, i.e., no diagonal entry is inf or NaN. */
+  static bool is_finite(T tol) {
+    return tol <= std::numeric_limits<T>::max();
+  }
+
+  static bool is_symmetric(const array_type& m, T tol) {
+    bool valid = true;
+    for (std::size_t i = 0; i < N; ++i) {
+      for (std::size_t j = i + 1; j < N; ++j) {
+        valid &= array_checks::is_near(m[N * i + j], m[N * j + i], tol);
+      }
+    }
+    return valid;
+  }
+
+  /**
+   * @brief Whether the symmetric matrix 'm' is positive semidefinite, via an
+   * in-place Cholesky factorization m = L L^T of its lower triangle.
+   *
+   * Row i of L is computed from dot products with the previous rows, which
+   * are contiguous in row-major order. A pivot within 'tol' of zero makes the
+   * corresponding column of L zero, which is only consistent if the rest of
+   * the column of the Schur complement is also within 'tol' of zero.
+   */
+  static bool is_positive_semidefinite(array_type l, T tol) {
+    for (std::size_t j = 0; j < N; ++j) {
+      T* row_j = &l[N * j];
+      const auto pivot = row_j[j] - dot(row_j, row_j, j);
+      if (!(pivot >= -tol)) {
+        return false;  // negative or NaN
+      }
+      const bool singular = (pivot <= tol);
+      const auto diagonal = singular ? static_cast<T>(0) : std::sqrt(pivot);
+      row_j[j] = diagonal;
+      for (std::size_t i = j + 1; i < N; ++i) {
+        T* row_i = &l[N * i];
+        const auto residual = row_i[j] - dot(row_i, row_j, j);
+        if (singular) {
+          if (!array_checks::is_near(residual, static_cast<T>(0), tol)) {
+            return false;
+          }
+          row_i[j] = static_cast<T>(0);
+        } else {
+          row_i[j] = residual / diagonal;
+        }
+      }
+    }
+    return true;
+  }
+
+  /** @brief Dot product of the first 'n' entries of two rows. */
+  static T dot(const T* a, const T* b, std::size_t n) {
+    T sum = static_cast<T>(0);
+    for (std::size_t k = 0; k < n; ++k) {
+      sum += a[k] * b[k];
+    }
+    return sum;
+  }
+
+  array_type m_;
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__COVARIANCE_MATRIX_HPP_
@@ -0,0 +1,139 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines math functions whose domain is guaranteed by the
+/// type of their argument.
+
+#ifndef CONTRACTS__MATH_HPP_
+#define CONTRACTS__MATH_HPP_
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CONTRACT_MATH_SSE2
+#endif
+
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/nonzero_real.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Instructions for functions whose argument is known to be in their
+ * domain.
+ * @note INTERNAL USE ONLY
+ */
+namespace math_detail {
+
+/**
+ * @brief Square root of 'x' >= 0 (or -0).
+ *
+ * std::sqrt must set errno for negative arguments, so unless errno handling
+ * is disabled (-fno-math-errno, which defines __NO_MATH_ERRNO__), compilers
+ * emit a compare and a fallback call to libm around the square root
+ * instruction, and cannot vectorize loops containing it. Compilers do not use
+ * the sign of the argument to remove them, so on x86 the instruction is then
+ * emitted directly. With -fno-math-errno, std::sqrt compiles to the
+ * instruction by itself, and unlike the intrinsic, loops of it vectorize, so
+ * it is preferred.
+ */
+inline float sqrt(float x) {
+#if defined(CONTRACT_MATH_SSE2) && !defined(__NO_MATH_ERRNO__)
+  return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x)));
+#else
+  return std::sqrt(x);
+#endif
+}
+
+/** @brief See sqrt(float). */
+inline double sqrt(double x) {
+#if defined(CONTRACT_MATH_SSE2) && !defined(__NO_MATH_ERRNO__)
+  const __m128d v = _mm_set_sd(x);
+  return _mm_cvtsd_f64(_mm_sqrt_sd(v, v));
+#else
+  return std::sqrt(x);
+#endif
+}
+
+}  // namespace math_detail
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Square root of a non-negative real, without the domain check and
+ * errno handling of std::sqrt.
+ *
+ * The square root of a finite non-negative real is a finite non-negative real,
+ * so the result is returned as one, without a check.
+ */
+template <typename T>
+NonnegativeReal<T> sqrt(NonnegativeReal<T> x) {
+  return NonnegativeReal<T>(math_detail::sqrt(static_cast<T>(x)),
+                            assume_valid);
+}
+
+/**
+ * @brief See sqrt(NonnegativeReal<T>). The square root of a strictly positive
+ * real is strictly positive, since the square root of the smallest subnormal
+ * is a normal number.
+ */
+template <typename T>
+StrictlyPositiveReal<T> sqrt(StrictlyPositiveReal<T> x) {
+  return StrictlyPositiveReal<T>(math_detail::sqrt(static_cast<T>(x)),
+                                 assume_valid);
+}
+
+/** @brief See sqrt(NonnegativeReal<T>). The square root of [0, 1] is [0, 1]. */
+template <typename T>
+UnitReal<T> sqrt(UnitReal<T> x) {
+  return UnitReal<T>(math_detail::sqrt(static_cast<T>(x)), assume_valid);
+}
+
+/**
+ * @brief Natural logarithm of a strictly positive real, which is a finite
+ * real, returned without a check.
+ *
+ * @note There is no instruction for the logarithm, so this calls std::log.
+ * Since the argument is in the domain, libm never takes its error path; the
+ * saving is the check that constructing a Real from std::log would enforce.
+ */
+template <typename T>
+Real<T> log(StrictlyPositiveReal<T> x) {
+  return Real<T>(std::log(static_cast<T>(x)), assume_valid);
+}
+
+/**
+ * @brief Reciprocal of a non-zero real, which is never zero or NaN.
+ *
+ * @note The result is a plain value, not a NonzeroReal, since the reciprocal
+ * of a subnormal overflows to infinity, which is outside of the range of
+ * NonzeroReal.
+ */
+template <typename T>
+T reciprocal(NonzeroReal<T> x) {
+  return static_cast<T>(1) / static_cast<T>(x);
+}
+
+}  // namespace contracts_lite
+
+#undef CONTRACT_MATH_SSE2
+
+#endif  // CONTRACTS__MATH_HPP_
@@ -0,0 +1,200 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines the monotonic sequence container.
+
+#ifndef CONTRACTS__MONOTONIC_SEQUENCE_HPP_
+#define CONTRACTS__MONOTONIC_SEQUENCE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "contracts_lite/array_checks.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/return_status.hpp"
+
+namespace contracts_lite {
+
+/** @brief Capacity of containers whose capacity is set at run time. */
+CONTRACT_INLINE_VARIABLE constexpr std::size_t dynamic_capacity =
+    std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Ring buffer of the most recent elements of a strictly increasing
+ * sequence, e.g., timestamps.
+ *
+ * The capacity is 'N' elements stored inline, or, if 'N' is dynamic_capacity,
+ * set at construction and stored on the heap. Once the buffer is full, each
+ * appended element replaces the oldest one.
+ *
+ * @note A monotonic sequence is 'valid' if and only if each element is greater
+ * than the element before it. Since the buffered elements are already known to
+ * be increasing, appending an element only requires comparing it with the last
+ * one, and appending a range requires comparing adjacent elements of the range
+ * (see array_checks::is_strictly_increasing). Neither depends on the number of
+ * buffered elements.
+ *
+ * @invariant The buffered elements are guaranteed to be valid after each
+ * successful operation.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, std::size_t N = dynamic_capacity>
+class MonotonicSequence {
+  static_assert(N > 0, "Monotonic sequence must have a positive capacity.");
+
+ public:
+  using value_type = T;
+  using storage_type =
+      typename std::conditional<(N == dynamic_capacity), std::vector<T>,
+                                std::array<T, N>>::type;
+
+  /** @brief Construct an empty sequence of fixed capacity 'N'. */
+  MonotonicSequence() : storage_(), head_(0), size_(0) {
+    static_assert(N != dynamic_capacity,
+                  "Dynamic monotonic sequences require a capacity.");
+  }
+
+  /**
+   * @brief Construct an empty sequence of run-time capacity 'capacity'.
+   *
+   * @pre 'capacity' is positive. This is enforced at the DEFAULT build level.
+   */
+  explicit MonotonicSequence(std::size_t capacity)
+      : storage_(capacity), head_(0), size_(0) {
+    static_assert(N == dynamic_capacity,
+                  "Fixed monotonic sequences have a compile-time capacity.");
+    DEFAULT_ENFORCE(range_checks::in_range_open_closed(
+        capacity, static_cast<std::size_t>(0), dynamic_capacity));
+  }
+
+  /**
+   * @brief Append an element.
+   *
+   * @pre 'value' is greater than back(), if any. This is enforced at the
+   * DEFAULT build level.
+   */
+  void push_back(const T& value) {
+    DEFAULT_ENFORCE(MonotonicSequence::check_append(&value, 1));
+    append_unchecked(value);
+  }
+
+  /**
+   * @brief Append the 'n' elements of 'values'. If 'n' exceeds the capacity,
+   * only the last elements are kept.
+   *
+   * @pre The values are strictly increasing and greater than back(), if any.
+   * This is enforced at the DEFAULT build level.
+   */
+  void append(const T* values, std::size_t n) {
+    DEFAULT_ENFORCE(MonotonicSequence::check_append(values, n));
+    const auto first = (n > capacity()) ? (n - capacity()) : 0;
+    for (std::size_t i = first; i < n; ++i) {
+      append_unchecked(values[i]);
+    }
+  }
+
+  /** @brief Remove all elements. The next element may have any value. */
+  void clear() {
+    head_ = 0;
+    size_ = 0;
+  }
+
+  std::size_t size() const { return size_; }
+  std::size_t capacity() const { return storage_.size(); }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == capacity(); }
+
+  /**
+   * @brief Element 'i', counting from the oldest buffered element.
+   *
+   * @pre 'i' is less than size(). This is enforced at the AUDIT build level.
+   */
+  const T& operator[](std::size_t i) const {
+    AUDIT_ENFORCE(range_checks::in_range_closed_open(
+        i, static_cast<std::size_t>(0), size_));
+    return storage_[wrap(head_ + i)];
+  }
+
+  /**
+   * @brief The oldest buffered element.
+   *
+   * @pre The sequence is not empty. This is enforced at the AUDIT build level.
+   */
+  const T& front() const { return (*this)[0]; }
+
+  /**
+   * @brief The newest element.
+   *
+   * @pre The sequence is not empty. This is enforced at the AUDIT build level.
+   */
+  const T& back() const { return (*this)[size_ - 1]; }
+
+  /**
+   * @brief Check that appending the 'n' elements of 'values' preserves the
+   * class invariant.
+   */
+  ReturnStatus check_append(const T* values, std::size_t n) const {
+    const bool follows_back = empty() || (n == 0) || (back() < values[0]);
+    auto comment = CONTRACT_COMMENT(
+        "", follows_back ? std::string()
+                         : std::string("appended element must be greater "
+                                       "than the last element"));
+    return ReturnStatus(std::move(comment), follows_back) &&
+           array_checks::strictly_increasing(values, n);
+  }
+
+  /** @brief Re-check the class invariant over the buffered elements. */
+  ReturnStatus check() const {
+    bool valid = true;
+    for (std::size_t i = 1; i < size_; ++i) {
+      valid &= ((*this)[i - 1] < (*this)[i]);
+    }
+    auto comment = CONTRACT_COMMENT(
+        "", valid ? std::string()
+                  : std::string("elements must be strictly increasing"));
+    return ReturnStatus(std::move(comment), valid);
+  }
+
+ private:
+  std::size_t wrap(std::size_t i) const {
+    return (i >= capacity()) ? (i - capacity()) : i;
+  }
+
+  void append_unchecked(const T& value) {
+    if (full()) {
+      storage_[head_] = value;
+      head_ = wrap(head_ + 1);
+    } else {
+      storage_[wrap(head_ + size_)] = value;
+      ++size_;
+    }
+  }
+
+  storage_type storage_;
+  std::size_t head_;
+  std::size_t size_;
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__MONOTONIC_SEQUENCE_HPP_
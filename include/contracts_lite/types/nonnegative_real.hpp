@@ -19,9 +19,9 @@
 #ifndef CONTRACTS__NONNEGATIVE_REAL_HPP_
 #define CONTRACTS__NONNEGATIVE_REAL_HPP_
 
-#include <limits>
+#include <ratio>
 
-#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
 
 namespace contracts_lite {
 /**
@@ -35,30 +35,8 @@ namespace contracts_lite {
  * @implements{SRD006}
  */
 template <typename T>
-class NonnegativeReal {
-  static_assert(std::numeric_limits<T>::is_iec559,
-                "NonnegativeReal numeric type must be IEEE float compliant.");
-
- public:
-  NonnegativeReal() = delete;
-
-  /** @brief Allow objects to be directly cast to float types. */
-  operator T() const { return r_; }
-
-  /**
-   * @brief Converting constructor for valid non-negative real objects.
-   *
-   * @post The class invariant validity condition holds (see invariant in
-   * NonnegativeReal).
-   */
-  NonnegativeReal(T r) : r_(r) {
-    DEFAULT_ENFORCE(contracts_lite::range_checks::in_range_closed_open(
-        r_, static_cast<T>(0), std::numeric_limits<T>::infinity()));
-  }
-
- private:
-  T r_;
-};
+using NonnegativeReal =
+    BoundedReal<T, std::ratio<0>, bounds::Infinity, interval::ClosedOpen>;
 
 }  // namespace contracts_lite
 
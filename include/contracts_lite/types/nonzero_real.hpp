@@ -21,6 +21,8 @@
 
 #include <limits>
 
+#include <contracts_lite/assume_valid.hpp>
+#include <contracts_lite/niche_traits.hpp>
 #include <contracts_lite/range_checks.hpp>
 #include <contracts_lite/simple_violation_handler.hpp>
 
@@ -52,20 +54,37 @@ class NonzeroReal {
    * @post The the class invariant validity condition holds (see invariant in
    * NonzeroReal).
    */
-  NonzeroReal(T r) : r_(r) {
+  NonzeroReal(T r) : r_(r) { DEFAULT_ENFORCE(NonzeroReal::check(r_)); }
+
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'r'. This is only
+   * enforced at the AUDIT build level.
+   */
+  NonzeroReal(T r, assume_valid_t) : r_(r) {
+    AUDIT_ENFORCE(NonzeroReal::check(r_));
+  }
+
+  /** @brief Range check enforcing the class invariant. */
+  static ReturnStatus check(T r) {
     const auto in_lower_range =
         contracts_lite::range_checks::in_range_open_open(
-            r_, -std::numeric_limits<T>::infinity(), static_cast<T>(0));
+            r, -std::numeric_limits<T>::infinity(), static_cast<T>(0));
     const auto in_upper_range =
         contracts_lite::range_checks::in_range_open_open(
-            r_, static_cast<T>(0), std::numeric_limits<T>::infinity());
-    DEFAULT_ENFORCE(in_lower_range || in_upper_range);
+            r, static_cast<T>(0), std::numeric_limits<T>::infinity());
+    return in_lower_range || in_upper_range;
   }
 
  private:
   T r_;
 };
 
+/** @brief NaN is outside of the valid range, so it is a niche. */
+template <typename T>
+struct niche_traits<NonzeroReal<T>> : nan_niche_traits<T> {};
+
 }  // namespace contracts_lite
 
 #endif  // CONTRACTS__NONZERO_REAL_H_
@@ -0,0 +1,300 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines the probability simplex types.
+
+#ifndef CONTRACTS__PROBABILITY_SIMPLEX_HPP_
+#define CONTRACTS__PROBABILITY_SIMPLEX_HPP_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "contracts_lite/array_checks.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Tolerance policies for the sum of a probability simplex.
+ *
+ * A policy provides a static constexpr function template 'value<T>(n)'
+ * returning the largest allowed |sum - 1| for 'n' probabilities of type 'T'.
+ */
+namespace simplex_tolerance {
+
+/**
+ * @brief A multiple 'K' of the machine epsilon of 'T', independent of 'n'.
+ *
+ * @note If each probability has a relative error of a few ulps, e.g., from a
+ * softmax, the error of the sum is a few ulps of one regardless of 'n'.
+ */
+template <std::size_t K>
+struct EpsilonMultiple {
+  template <typename T>
+  static constexpr T value(std::size_t) {
+    return static_cast<T>(K) * std::numeric_limits<T>::epsilon();
+  }
+};
+
+/** @brief A fixed tolerance given by bound 'B' (see the bounds namespace). */
+template <typename B>
+struct Absolute {
+  template <typename T>
+  static constexpr T value(std::size_t) {
+    return bounds::value_of<T, B>::value();
+  }
+};
+
+}  // namespace simplex_tolerance
+
+/** @brief Default tolerance policy of the probability simplex types. */
+using DefaultSimplexTolerance = simplex_tolerance::EpsilonMultiple<64>;
+
+namespace simplex_checks {
+
+/** @brief Predicate for the probability simplex invariant. */
+template <typename T, typename Tolerance>
+bool is_valid(const T* p, std::size_t n) {
+  const auto s = array_checks::sum_and_range(p, n, static_cast<T>(0),
+                                             static_cast<T>(1));
+  return s.in_range & array_checks::is_near(s.sum, static_cast<T>(1),
+                                            Tolerance::template value<T>(n));
+}
+
+/** @brief Check enforcing the probability simplex invariant. */
+template <typename T, typename Tolerance>
+ReturnStatus check(const T* p, std::size_t n) {
+  const auto s = array_checks::sum_and_range(p, n, static_cast<T>(0),
+                                             static_cast<T>(1));
+  auto comment = CONTRACT_COMMENT(
+      "", std::to_string(n) + " probabilities must each be inside the range " +
+              "[0, 1]");
+  return ReturnStatus(std::move(comment), s.in_range) &&
+         array_checks::near(s.sum, static_cast<T>(1),
+                            Tolerance::template value<T>(n));
+}
+
+/**
+ * @brief Divide the 'n' non-negative weights in 'w' by their sum, in place.
+ *
+ * @pre The weights are finite and non-negative with a positive sum. This is
+ * enforced at the DEFAULT build level, while reading the weights to sum them.
+ *
+ * @post The weights are each in [0, 1], and their sum is one up to rounding
+ * error. This is not re-checked.
+ *
+ * @note The weights are divided by the sum, rather than multiplied by its
+ * reciprocal, which overflows for tiny sums. Each quotient is in [0, 1], since
+ * each weight is at most the sum.
+ */
+template <typename T>
+void normalize(T* w, std::size_t n) {
+  const auto s = array_checks::sum_and_range(
+      w, n, static_cast<T>(0), std::numeric_limits<T>::max());
+  auto comment = CONTRACT_COMMENT(
+      "", std::to_string(n) + " weights must each be inside the range [0, " +
+              gcc_7x_to_string_fix(std::numeric_limits<T>::max()) + "]");
+  DEFAULT_ENFORCE(ReturnStatus(std::move(comment), s.in_range) &&
+                  range_checks::in_range_open_open(
+                      s.sum, static_cast<T>(0),
+                      std::numeric_limits<T>::infinity()));
+  for (std::size_t i = 0; i < n; ++i) {
+    w[i] /= s.sum;
+  }
+}
+
+}  // namespace simplex_checks
+
+/**
+ * @brief Container for probability distributions over 'N' outcomes.
+ *
+ * @note A probability simplex is 'valid' if and only if each probability is in
+ * [0, 1] and their sum is within the tolerance given by the 'Tolerance' policy
+ * (see the simplex_tolerance namespace) of one. Both conditions are checked in
+ * a single pass (see array_checks::sum_and_range).
+ *
+ * @invariant The probabilities of these objects are guaranteed to be valid
+ * upon successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, std::size_t N,
+          typename Tolerance = DefaultSimplexTolerance>
+class ProbabilitySimplex {
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "Probability simplex numeric type must be IEEE float "
+                "compliant.");
+  static_assert(N > 0, "Probability simplex must have at least one outcome.");
+
+ public:
+  using value_type = T;
+  using tolerance_type = Tolerance;
+
+  ProbabilitySimplex() = delete;
+
+  /**
+   * @brief Constructor for valid probability simplex objects.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * ProbabilitySimplex).
+   */
+  explicit ProbabilitySimplex(const std::array<T, N>& p) : p_(p) {
+    DEFAULT_ENFORCE(ProbabilitySimplex::check(p_));
+  }
+
+  /**
+   * @brief Trusted constructor for probabilities already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'p'. This is only
+   * enforced at the AUDIT build level.
+   */
+  ProbabilitySimplex(const std::array<T, N>& p, assume_valid_t) : p_(p) {
+    AUDIT_ENFORCE(ProbabilitySimplex::check(p_));
+  }
+
+  /**
+   * @brief Construct the distribution proportional to the weights 'w'.
+   *
+   * The weights are validated while summing them, so normalization and
+   * validation take one pass to sum and one pass to scale. The sum of the
+   * result is one up to rounding error, which is only checked against
+   * 'Tolerance' at the AUDIT build level.
+   *
+   * @pre The weights are finite and non-negative with a positive sum. This is
+   * enforced at the DEFAULT build level.
+   */
+  static ProbabilitySimplex normalize_and_validate(std::array<T, N> w) {
+    simplex_checks::normalize(w.data(), N);
+    return ProbabilitySimplex(w, assume_valid);
+  }
+
+  static constexpr std::size_t size() { return N; }
+  T operator[](std::size_t i) const { return p_[i]; }
+  const T* begin() const { return p_.data(); }
+  const T* end() const { return p_.data() + N; }
+
+  /** @brief The probabilities as an array. */
+  const std::array<T, N>& array() const { return p_; }
+
+  /** @brief Predicate for the class invariant. */
+  static bool is_valid(const std::array<T, N>& p) {
+    return simplex_checks::is_valid<T, Tolerance>(p.data(), N);
+  }
+
+  /** @brief Check enforcing the class invariant. */
+  static ReturnStatus check(const std::array<T, N>& p) {
+    return simplex_checks::check<T, Tolerance>(p.data(), N);
+  }
+
+ private:
+  std::array<T, N> p_;
+};
+
+/**
+ * @brief Non-owning view of a probability distribution of run-time size.
+ *
+ * @note The invariant is the same as for ProbabilitySimplex. It is checked
+ * when the view is constructed, so the viewed data must not be modified for
+ * the lifetime of the view.
+ *
+ * @invariant The viewed probabilities are guaranteed to be valid upon
+ * successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, typename Tolerance = DefaultSimplexTolerance>
+class ProbabilitySimplexView {
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "Probability simplex numeric type must be IEEE float "
+                "compliant.");
+
+ public:
+  using value_type = T;
+  using tolerance_type = Tolerance;
+
+  ProbabilitySimplexView() = delete;
+
+  /**
+   * @brief Constructor for valid views of the 'n' probabilities in 'p'.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * ProbabilitySimplexView).
+   */
+  ProbabilitySimplexView(const T* p, std::size_t n) : p_(p), n_(n) {
+    DEFAULT_ENFORCE(ProbabilitySimplexView::check(p_, n_));
+  }
+
+  /**
+   * @brief Trusted constructor for probabilities already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'p'. This is only
+   * enforced at the AUDIT build level.
+   */
+  ProbabilitySimplexView(const T* p, std::size_t n, assume_valid_t)
+      : p_(p), n_(n) {
+    AUDIT_ENFORCE(ProbabilitySimplexView::check(p_, n_));
+  }
+
+  /** @brief View of a probability simplex. */
+  template <std::size_t N>
+  ProbabilitySimplexView(const ProbabilitySimplex<T, N, Tolerance>& p)
+      : p_(p.begin()), n_(N) {}
+
+  /**
+   * @brief Normalize the 'n' weights in 'w' in place and view the resulting
+   * distribution.
+   *
+   * The weights are validated while summing them, so normalization and
+   * validation take one pass to sum and one pass to scale. The sum of the
+   * result is one up to rounding error, which is only checked against
+   * 'Tolerance' at the AUDIT build level.
+   *
+   * @pre The weights are finite and non-negative with a positive sum. This is
+   * enforced at the DEFAULT build level.
+   */
+  static ProbabilitySimplexView normalize_and_validate(T* w, std::size_t n) {
+    simplex_checks::normalize(w, n);
+    return ProbabilitySimplexView(w, n, assume_valid);
+  }
+
+  std::size_t size() const { return n_; }
+  T operator[](std::size_t i) const { return p_[i]; }
+  const T* begin() const { return p_; }
+  const T* end() const { return p_ + n_; }
+
+  /** @brief Predicate for the class invariant. */
+  static bool is_valid(const T* p, std::size_t n) {
+    return simplex_checks::is_valid<T, Tolerance>(p, n);
+  }
+
+  /** @brief Check enforcing the class invariant. */
+  static ReturnStatus check(const T* p, std::size_t n) {
+    return simplex_checks::check<T, Tolerance>(p, n);
+  }
+
+ private:
+  const T* p_;
+  std::size_t n_;
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__PROBABILITY_SIMPLEX_HPP_
@@ -0,0 +1,299 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines physical quantities with compile-time units.
+
+#ifndef CONTRACTS__QUANTITY_HPP_
+#define CONTRACTS__QUANTITY_HPP_
+
+#include <ratio>
+#include <type_traits>
+
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Physical dimension as the exponents of length, mass and time.
+ */
+template <int L, int M, int T>
+struct Dimension {
+  static constexpr int length = L;
+  static constexpr int mass = M;
+  static constexpr int time = T;
+};
+
+namespace dimensions {
+
+using Dimensionless = Dimension<0, 0, 0>;
+using Length = Dimension<1, 0, 0>;
+using Mass = Dimension<0, 1, 0>;
+using Time = Dimension<0, 0, 1>;
+using Velocity = Dimension<1, 0, -1>;
+using Acceleration = Dimension<1, 0, -2>;
+
+/** @brief Dimension of the product of quantities of dimensions 'A' and 'B'. */
+template <typename A, typename B>
+using multiply = Dimension<A::length + B::length, A::mass + B::mass,
+                           A::time + B::time>;
+
+/** @brief Dimension of the quotient of quantities of dimensions 'A' and 'B'. */
+template <typename A, typename B>
+using divide = Dimension<A::length - B::length, A::mass - B::mass,
+                         A::time - B::time>;
+
+}  // namespace dimensions
+
+/**
+ * @brief How a quantity stores its value: either as a plain arithmetic type,
+ * or as a contract type (e.g., NonnegativeReal) that provides 'value_type', a
+ * checked constructor and a trusted constructor.
+ */
+template <typename Rep, typename = void>
+struct quantity_rep_traits {
+  using value_type = typename Rep::value_type;
+  static constexpr bool has_contract = true;
+  static Rep make(value_type v) { return Rep(v); }
+  static Rep make(value_type v, assume_valid_t) {
+    return Rep(v, assume_valid);
+  }
+};
+
+/** @brief Plain arithmetic representations have no contract. */
+template <typename Rep>
+struct quantity_rep_traits<
+    Rep, typename std::enable_if<std::is_arithmetic<Rep>::value>::type> {
+  using value_type = Rep;
+  static constexpr bool has_contract = false;
+  static Rep make(value_type v) { return v; }
+  static Rep make(value_type v, assume_valid_t) { return v; }
+};
+
+/**
+ * @brief Container for physical quantities of dimension 'Dim', in units of
+ * 'Scale' (a std::ratio) times the SI unit, with representation 'Rep'.
+ *
+ * Quantities of different dimensions cannot be mixed up, and quantities of
+ * the same dimension convert implicitly between scales, multiplying by a
+ * factor computed at compile time. Products and quotients have the dimension
+ * and scale computed at compile time.
+ *
+ * @note If 'Rep' is a contract type, e.g., NonnegativeReal<float>, a quantity
+ * is 'valid' if and only if its value is valid for 'Rep'. The value is checked
+ * when a quantity is constructed or converted from another scale, since scale
+ * conversions can overflow or underflow. Arithmetic returns quantities of the
+ * plain value type, as arithmetic on BoundedReal returns plain values. With
+ * a plain 'Rep', or with contracts OFF, quantities compile to the same code as
+ * the equivalent arithmetic on the value type.
+ *
+ * @invariant The value of these objects is guaranteed to be valid upon
+ * successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename Dim, typename Scale, typename Rep = float>
+class Quantity {
+  using Traits = quantity_rep_traits<Rep>;
+
+ public:
+  using dimension = Dim;
+  using scale = Scale;
+  using rep = Rep;
+  using value_type = typename Traits::value_type;
+
+  static_assert(std::is_floating_point<value_type>::value,
+                "Quantity value type must be floating point.");
+  static_assert(Scale::num > 0, "Quantity scale must be positive.");
+
+  Quantity() = delete;
+
+  /**
+   * @brief Constructor from a value in units of 'Scale'.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * Quantity). If 'Rep' has a contract, it is enforced as by its checked
+   * constructor.
+   */
+  explicit Quantity(value_type v) : v_(Traits::make(v)) {}
+
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'v'. If 'Rep' has a
+   * contract, this is only enforced at the AUDIT build level.
+   */
+  Quantity(value_type v, assume_valid_t) : v_(Traits::make(v, assume_valid)) {}
+
+  /** @brief Conversion from a quantity of the same dimension. */
+  template <typename Scale2, typename Rep2>
+  Quantity(const Quantity<Dim, Scale2, Rep2>& q)
+      : v_(Traits::make(q.count() * factor_from<Scale2>())) {}
+
+  /** @brief The value in units of 'Scale'. */
+  value_type count() const { return v_; }
+
+  /** @brief The value as its representation, e.g., a contract type. */
+  const Rep& value() const { return v_; }
+
+  /** @brief The value in units of 'Scale2'. */
+  template <typename Scale2>
+  value_type count_in() const {
+    return Quantity<Dim, Scale2, value_type>(*this).count();
+  }
+
+  /** @brief Factor converting values in units of 'Scale2' to 'Scale'. */
+  template <typename Scale2>
+  static constexpr value_type factor_from() {
+    return bounds::value_of<value_type,
+                            std::ratio_divide<Scale2, Scale>>::value();
+  }
+
+ private:
+  Rep v_;
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Plain quantity type of the result of adding or comparing quantities
+ * of scales 'S1' and 'S2', in units of the finer scale, with the value type of
+ * representation 'Rep'.
+ */
+template <typename Dim, typename S1, typename S2, typename Rep>
+using common_quantity =
+    Quantity<Dim,
+             typename std::conditional<std::ratio_less<S2, S1>::value, S2,
+                                       S1>::type,
+             typename quantity_rep_traits<Rep>::value_type>;
+
+template <typename Dim, typename S1, typename R1, typename S2, typename R2,
+          typename C = common_quantity<Dim, S1, S2, R1>>
+C operator+(const Quantity<Dim, S1, R1>& a, const Quantity<Dim, S2, R2>& b) {
+  return C(C(a).count() + C(b).count());
+}
+
+template <typename Dim, typename S1, typename R1, typename S2, typename R2,
+          typename C = common_quantity<Dim, S1, S2, R1>>
+C operator-(const Quantity<Dim, S1, R1>& a, const Quantity<Dim, S2, R2>& b) {
+  return C(C(a).count() - C(b).count());
+}
+
+template <typename Dim, typename S, typename R>
+Quantity<Dim, S, typename Quantity<Dim, S, R>::value_type> operator-(
+    const Quantity<Dim, S, R>& a) {
+  using Q = Quantity<Dim, S, typename Quantity<Dim, S, R>::value_type>;
+  return Q(-a.count());
+}
+
+template <typename D1, typename S1, typename R1, typename D2, typename S2,
+          typename R2>
+Quantity<dimensions::multiply<D1, D2>, std::ratio_multiply<S1, S2>,
+         typename Quantity<D1, S1, R1>::value_type>
+operator*(const Quantity<D1, S1, R1>& a, const Quantity<D2, S2, R2>& b) {
+  using Q = Quantity<dimensions::multiply<D1, D2>, std::ratio_multiply<S1, S2>,
+                     typename Quantity<D1, S1, R1>::value_type>;
+  return Q(a.count() * b.count());
+}
+
+template <typename D1, typename S1, typename R1, typename D2, typename S2,
+          typename R2>
+Quantity<dimensions::divide<D1, D2>, std::ratio_divide<S1, S2>,
+         typename Quantity<D1, S1, R1>::value_type>
+operator/(const Quantity<D1, S1, R1>& a, const Quantity<D2, S2, R2>& b) {
+  using Q = Quantity<dimensions::divide<D1, D2>, std::ratio_divide<S1, S2>,
+                     typename Quantity<D1, S1, R1>::value_type>;
+  return Q(a.count() / b.count());
+}
+
+template <typename Dim, typename S, typename R>
+Quantity<Dim, S, typename Quantity<Dim, S, R>::value_type> operator*(
+    const Quantity<Dim, S, R>& a,
+    typename Quantity<Dim, S, R>::value_type k) {
+  using Q = Quantity<Dim, S, typename Quantity<Dim, S, R>::value_type>;
+  return Q(a.count() * k);
+}
+
+template <typename Dim, typename S, typename R>
+Quantity<Dim, S, typename Quantity<Dim, S, R>::value_type> operator*(
+    typename Quantity<Dim, S, R>::value_type k,
+    const Quantity<Dim, S, R>& a) {
+  return a * k;
+}
+
+template <typename Dim, typename S, typename R>
+Quantity<Dim, S, typename Quantity<Dim, S, R>::value_type> operator/(
+    const Quantity<Dim, S, R>& a,
+    typename Quantity<Dim, S, R>::value_type k) {
+  using Q = Quantity<Dim, S, typename Quantity<Dim, S, R>::value_type>;
+  return Q(a.count() / k);
+}
+
+//------------------------------------------------------------------------------
+
+#define CONTRACT_QUANTITY_COMPARISON(op)                         \
+  template <typename Dim, typename S1, typename R1, typename S2, \
+            typename R2>                                         \
+  bool operator op(const Quantity<Dim, S1, R1>& a,               \
+                   const Quantity<Dim, S2, R2>& b) {             \
+    using C = common_quantity<Dim, S1, S2, R1>;                  \
+    return C(a).count() op C(b).count();                         \
+  }
+
+CONTRACT_QUANTITY_COMPARISON(==)
+CONTRACT_QUANTITY_COMPARISON(!=)
+CONTRACT_QUANTITY_COMPARISON(<)
+CONTRACT_QUANTITY_COMPARISON(<=)
+CONTRACT_QUANTITY_COMPARISON(>)
+CONTRACT_QUANTITY_COMPARISON(>=)
+
+#undef CONTRACT_QUANTITY_COMPARISON
+
+//------------------------------------------------------------------------------
+
+/** @brief Common units. 'Rep' may be a contract type, e.g., NonnegativeReal. */
+namespace units {
+
+template <typename Rep = float>
+using Meters = Quantity<dimensions::Length, std::ratio<1>, Rep>;
+template <typename Rep = float>
+using Millimeters = Quantity<dimensions::Length, std::milli, Rep>;
+template <typename Rep = float>
+using Kilometers = Quantity<dimensions::Length, std::kilo, Rep>;
+
+template <typename Rep = float>
+using Kilograms = Quantity<dimensions::Mass, std::ratio<1>, Rep>;
+
+template <typename Rep = float>
+using Seconds = Quantity<dimensions::Time, std::ratio<1>, Rep>;
+template <typename Rep = float>
+using Milliseconds = Quantity<dimensions::Time, std::milli, Rep>;
+template <typename Rep = float>
+using Microseconds = Quantity<dimensions::Time, std::micro, Rep>;
+template <typename Rep = float>
+using Nanoseconds = Quantity<dimensions::Time, std::nano, Rep>;
+
+template <typename Rep = float>
+using MetersPerSecond = Quantity<dimensions::Velocity, std::ratio<1>, Rep>;
+template <typename Rep = float>
+using MetersPerSecondSquared =
+    Quantity<dimensions::Acceleration, std::ratio<1>, Rep>;
+
+}  // namespace units
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__QUANTITY_HPP_
@@ -0,0 +1,343 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines values with compile-time interval arithmetic.
+
+#ifndef CONTRACTS__RANGED_HPP_
+#define CONTRACTS__RANGED_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/float_bits.hpp"
+#include "contracts_lite/niche_traits.hpp"
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Compile-time helpers for Ranged.
+ * @note INTERNAL USE ONLY
+ */
+namespace ranged_detail {
+
+template <typename A, typename B>
+using ratio_min =
+    typename std::conditional<std::ratio_less<B, A>::value, B, A>::type;
+
+template <typename A, typename B>
+using ratio_max =
+    typename std::conditional<std::ratio_less<A, B>::value, B, A>::type;
+
+/** @brief Whether the integer 'n' is exactly representable in 'T'. */
+template <typename T>
+constexpr bool is_representable(std::intmax_t n) {
+  return std::is_floating_point<T>::value
+             ? (std::numeric_limits<T>::digits >= 63 ||
+                (n < (std::intmax_t(1) << std::numeric_limits<T>::digits) &&
+                 -n < (std::intmax_t(1) << std::numeric_limits<T>::digits)))
+             : (std::is_signed<T>::value
+                    ? (n >= static_cast<std::intmax_t>(
+                                std::numeric_limits<T>::min()) &&
+                       n <= static_cast<std::intmax_t>(
+                                std::numeric_limits<T>::max()))
+                    : (n >= 0 && static_cast<std::uintmax_t>(n) <=
+                                     static_cast<std::uintmax_t>(
+                                         std::numeric_limits<T>::max())));
+}
+
+/** @brief Whether ratio 'R' converts to 'T' without rounding. */
+template <typename T, typename R>
+constexpr bool is_exact() {
+  return is_representable<T>(R::num) && ((R::den & (R::den - 1)) == 0) &&
+         (std::is_floating_point<T>::value || R::den == 1);
+}
+
+/** @brief Bounds of the products of [LoA, HiA] and [LoB, HiB]. */
+template <typename LoA, typename HiA, typename LoB, typename HiB>
+struct product_bounds {
+  using p1 = std::ratio_multiply<LoA, LoB>;
+  using p2 = std::ratio_multiply<LoA, HiB>;
+  using p3 = std::ratio_multiply<HiA, LoB>;
+  using p4 = std::ratio_multiply<HiA, HiB>;
+  using lower = ratio_min<ratio_min<p1, p2>, ratio_min<p3, p4>>;
+  using upper = ratio_max<ratio_max<p1, p2>, ratio_max<p3, p4>>;
+};
+
+}  // namespace ranged_detail
+
+/**
+ * @brief Container for values in the closed interval [Lo, Hi], where the
+ * bounds are std::ratio types, with interval arithmetic at compile time.
+ *
+ * The arithmetic operators return the Ranged type of the interval of their
+ * result, e.g., the sum of two Ranged<T, std::ratio<0>, std::ratio<1>> is a
+ * Ranged<T, std::ratio<0>, std::ratio<2>>, so results are not re-checked.
+ * narrow() converts to contract types (e.g., UnitReal, AcuteDegree,
+ * SizeBound) and only checks at run time if the interval of the source is not
+ * a subset of the valid range of the target.
+ *
+ * @note A ranged value is 'valid' if and only if it is in [Lo, Hi], with the
+ * bounds rounded to 'T' (see bounds::value_of). If a floating-point result
+ * could round outside its interval, i.e., if a bound involved is not exactly
+ * representable in 'T', the result is clamped into its interval, as for the
+ * conversions between AcuteDegree and AcuteRadian. Integer types require
+ * integer bounds that fit in 'T', so their arithmetic cannot overflow.
+ *
+ * @invariant The value of these objects is guaranteed to be valid upon
+ * successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, typename Lo, typename Hi>
+class Ranged {
+  static_assert(std::is_arithmetic<T>::value,
+                "Ranged numeric type must be arithmetic.");
+  static_assert(std::is_integral<T>::value ||
+                    std::numeric_limits<T>::is_iec559,
+                "Ranged floating point type must be IEEE float compliant.");
+  static_assert(!std::ratio_less<Hi, Lo>::value,
+                "Ranged lower bound must not exceed the upper bound.");
+  static_assert(std::is_floating_point<T>::value ||
+                    (ranged_detail::is_exact<T, Lo>() &&
+                     ranged_detail::is_exact<T, Hi>()),
+                "Ranged integer bounds must be integers representable in the "
+                "numeric type.");
+
+ public:
+  using value_type = T;
+  using lower_bound = Lo;
+  using upper_bound = Hi;
+
+  /** @brief The lower bound of the interval. */
+  static constexpr T min() { return bounds::value_of<T, Lo>::value(); }
+
+  /** @brief The upper bound of the interval. */
+  static constexpr T max() { return bounds::value_of<T, Hi>::value(); }
+
+  Ranged() = delete;
+
+  /** @brief Allow objects to be directly cast to numeric types. */
+  operator T() const { return r_; }
+
+  /**
+   * @brief Constructor for valid ranged objects.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * Ranged).
+   */
+  explicit Ranged(T r) : r_(r) { DEFAULT_ENFORCE(Ranged::check(r_)); }
+
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'r'. This is only
+   * enforced at the AUDIT build level.
+   */
+  Ranged(T r, assume_valid_t) : r_(r) { AUDIT_ENFORCE(Ranged::check(r_)); }
+
+  /** @brief Widening conversion from a Ranged type with a sub-interval. */
+  template <typename Lo2, typename Hi2,
+            typename = typename std::enable_if<
+                Ranged<T, Lo2, Hi2>::template is_subset_of<Ranged>()>::type>
+  Ranged(Ranged<T, Lo2, Hi2> r) : r_(r) {}
+
+  /**
+   * @brief Conversion from a bounded real whose interval is a subset, e.g., a
+   * UnitReal to a Ranged<T, std::ratio<0>, std::ratio<1>>.
+   */
+  template <typename Lo2, typename Hi2, typename Interval,
+            typename B = BoundedReal<T, Lo2, Hi2, Interval>,
+            typename = typename std::enable_if<(Ranged::min() <= B::min()) &&
+                                               (B::max() <= Ranged::max())>::
+                type>
+  Ranged(const BoundedReal<T, Lo2, Hi2, Interval>& r) : r_(r) {}
+
+  /**
+   * @brief Whether both bounds convert to 'T' exactly, so that results with
+   * exact bounds computed from exact operands are never rounded outside of
+   * their interval.
+   */
+  static constexpr bool is_exact() {
+    return ranged_detail::is_exact<T, Lo>() &&
+           ranged_detail::is_exact<T, Hi>();
+  }
+
+  /**
+   * @brief Whether every valid value is valid for contract type 'Target',
+   * which provides a constexpr 'is_valid'. Since the valid range of 'Target'
+   * is an interval, it is enough to check the bounds.
+   */
+  template <typename Target>
+  static constexpr bool is_subset_of() {
+    return Target::is_valid(Ranged::min()) && Target::is_valid(Ranged::max());
+  }
+
+  /** @brief Predicate for the class invariant. */
+  static constexpr bool is_valid(T r) {
+    return float_bits::greater_equal(r, Ranged::min()) &&
+           float_bits::less_equal(r, Ranged::max());
+  }
+
+  /** @brief Range check enforcing the class invariant. */
+  static ReturnStatus check(T r) {
+    return range_checks::in_range_closed_closed(r, Ranged::min(),
+                                                Ranged::max());
+  }
+
+  /**
+   * @brief Construct the result of an operation on values of types
+   * 'Operands', clamping it into the interval if it may have been rounded
+   * outside of it.
+   * @note INTERNAL USE ONLY
+   */
+  template <typename... Operands>
+  static Ranged from_result(T r) {
+    return Ranged(all_exact<Ranged, Operands...>() ? r : clamp(r),
+                  assume_valid);
+  }
+
+ private:
+  template <typename R>
+  static constexpr bool all_exact() {
+    return R::is_exact();
+  }
+  template <typename R, typename S, typename... Rs>
+  static constexpr bool all_exact() {
+    return R::is_exact() && all_exact<S, Rs...>();
+  }
+
+  static T clamp(T r) {
+    return (r < Ranged::min()) ? Ranged::min()
+                               : ((r > Ranged::max()) ? Ranged::max() : r);
+  }
+
+  T r_;
+};
+
+/** @brief NaN is outside of every interval, so it is a niche of Ranged. */
+template <typename T, typename Lo, typename Hi>
+struct niche_traits<Ranged<T, Lo, Hi>>
+    : std::conditional<std::is_floating_point<T>::value, nan_niche_traits<T>,
+                       niche_traits<void>>::type {};
+
+/** @brief Ranged type of a bounded real with std::ratio bounds. */
+template <typename T, typename Lo, typename Hi, typename Interval>
+Ranged<T, Lo, Hi> make_ranged(const BoundedReal<T, Lo, Hi, Interval>& r) {
+  return Ranged<T, Lo, Hi>(r);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename T, typename Lo, typename Hi>
+Ranged<T, std::ratio_multiply<Hi, std::ratio<-1>>,
+       std::ratio_multiply<Lo, std::ratio<-1>>>
+operator-(Ranged<T, Lo, Hi> a) {
+  // Negation is exact, and so are negated bounds.
+  return {-static_cast<T>(a), assume_valid};
+}
+
+template <typename T, typename LoA, typename HiA, typename LoB, typename HiB>
+Ranged<T, std::ratio_add<LoA, LoB>, std::ratio_add<HiA, HiB>> operator+(
+    Ranged<T, LoA, HiA> a, Ranged<T, LoB, HiB> b) {
+  using R = Ranged<T, std::ratio_add<LoA, LoB>, std::ratio_add<HiA, HiB>>;
+  return R::template from_result<Ranged<T, LoA, HiA>, Ranged<T, LoB, HiB>>(
+      static_cast<T>(a) + static_cast<T>(b));
+}
+
+template <typename T, typename LoA, typename HiA, typename LoB, typename HiB>
+Ranged<T, std::ratio_subtract<LoA, HiB>, std::ratio_subtract<HiA, LoB>>
+operator-(Ranged<T, LoA, HiA> a, Ranged<T, LoB, HiB> b) {
+  using R =
+      Ranged<T, std::ratio_subtract<LoA, HiB>, std::ratio_subtract<HiA, LoB>>;
+  return R::template from_result<Ranged<T, LoA, HiA>, Ranged<T, LoB, HiB>>(
+      static_cast<T>(a) - static_cast<T>(b));
+}
+
+template <typename T, typename LoA, typename HiA, typename LoB, typename HiB>
+Ranged<T, typename ranged_detail::product_bounds<LoA, HiA, LoB, HiB>::lower,
+       typename ranged_detail::product_bounds<LoA, HiA, LoB, HiB>::upper>
+operator*(Ranged<T, LoA, HiA> a, Ranged<T, LoB, HiB> b) {
+  using P = ranged_detail::product_bounds<LoA, HiA, LoB, HiB>;
+  using R = Ranged<T, typename P::lower, typename P::upper>;
+  return R::template from_result<Ranged<T, LoA, HiA>, Ranged<T, LoB, HiB>>(
+      static_cast<T>(a) * static_cast<T>(b));
+}
+
+/**
+ * @brief Quotient of ranged values. The interval of the divisor must not
+ * contain zero, and the numeric type must be floating point.
+ */
+template <typename T, typename LoA, typename HiA, typename LoB, typename HiB>
+Ranged<T,
+       typename ranged_detail::product_bounds<
+           LoA, HiA, std::ratio_divide<std::ratio<1>, HiB>,
+           std::ratio_divide<std::ratio<1>, LoB>>::lower,
+       typename ranged_detail::product_bounds<
+           LoA, HiA, std::ratio_divide<std::ratio<1>, HiB>,
+           std::ratio_divide<std::ratio<1>, LoB>>::upper>
+operator/(Ranged<T, LoA, HiA> a, Ranged<T, LoB, HiB> b) {
+  static_assert(std::is_floating_point<T>::value,
+                "Ranged division requires a floating point type.");
+  static_assert(std::ratio_less<std::ratio<0>, LoB>::value ||
+                    std::ratio_less<HiB, std::ratio<0>>::value,
+                "Ranged divisor interval must not contain zero.");
+  using P = ranged_detail::product_bounds<
+      LoA, HiA, std::ratio_divide<std::ratio<1>, HiB>,
+      std::ratio_divide<std::ratio<1>, LoB>>;
+  using R = Ranged<T, typename P::lower, typename P::upper>;
+  return R::template from_result<Ranged<T, LoA, HiA>, Ranged<T, LoB, HiB>>(
+      static_cast<T>(a) / static_cast<T>(b));
+}
+
+//------------------------------------------------------------------------------
+
+namespace ranged_detail {
+
+template <typename Target, typename T>
+Target narrow(T r, std::true_type) {
+  return Target(r, assume_valid);
+}
+
+template <typename Target, typename T>
+Target narrow(T r, std::false_type) {
+  return Target(r);
+}
+
+}  // namespace ranged_detail
+
+/**
+ * @brief Convert 'r' to contract type 'Target', which provides a constexpr
+ * 'is_valid' and a trusted constructor.
+ *
+ * If the interval of 'r' is a subset of the valid range of 'Target', the
+ * conversion uses the trusted constructor and is only checked at the AUDIT
+ * build level. Otherwise, the value is checked as by the checked constructor.
+ */
+template <typename Target, typename T, typename Lo, typename Hi>
+Target narrow(Ranged<T, Lo, Hi> r) {
+  using subset = std::integral_constant<
+      bool, Ranged<T, Lo, Hi>::template is_subset_of<Target>()>;
+  return ranged_detail::narrow<Target>(static_cast<T>(r), subset());
+}
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__RANGED_HPP_
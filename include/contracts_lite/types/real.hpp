@@ -19,7 +19,7 @@
 #ifndef CONTRACTS__REAL_HPP_
 #define CONTRACTS__REAL_HPP_
 
-#include <cmath>
+#include "contracts_lite/types/bounded_real.hpp"
 
 namespace contracts_lite {
 /**
@@ -33,32 +33,8 @@ namespace contracts_lite {
  * @implements{SRD006}
  */
 template <typename T>
-class Real {
-  static_assert(std::numeric_limits<T>::is_iec559,
-                "Real numeric type must be IEEE float compliant.");
-
- public:
-  Real() = delete;
-
-  /** @brief Allow objects to be directly cast to float types. */
-  operator T() const { return r_; }
-
-  /**
-   * @brief Converting constructor for valid real objects.
-   *
-   * @post The class invariant validity condition holds (see invariant in Real).
-   */
-  Real(T r) : r_(r) {
-    DEFAULT_ENFORCE([&]() {
-      auto comment =
-          CONTRACT_COMMENT("", gcc_7x_to_string_fix(r_) + " must be finite");
-      return ReturnStatus(std::move(comment), std::isfinite(r_));
-    }());
-  }
-
- private:
-  T r_;
-};
+using Real = BoundedReal<T, bounds::NegativeInfinity, bounds::Infinity,
+                         interval::OpenOpen>;
 
 }  // namespace contracts_lite
 
@@ -0,0 +1,250 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines the 3D rotation matrix type.
+
+#ifndef CONTRACTS__ROTATION_MATRIX3_HPP_
+#define CONTRACTS__ROTATION_MATRIX3_HPP_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "contracts_lite/array_checks.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+#include "contracts_lite/types/unit_quaternion.hpp"
+#include "contracts_lite/types/unit_vector3.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Container for 3D rotation matrices, stored in row-major order.
+ *
+ * @note A rotation matrix is 'valid' if and only if its rows are orthonormal
+ * within 'Tol' (see the bounds namespace), i.e., |dot(r_i, r_j) - delta_ij| <=
+ * Tol, and its determinant is positive.
+ *
+ * @note Products of rotation matrices are rotation matrices up to rounding
+ * error, so operations re-orthonormalize their results and construct them with
+ * the trusted constructor. The invariant is then only re-checked at the AUDIT
+ * build level.
+ *
+ * @invariant The entries of these objects are guaranteed to be valid upon
+ * successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, typename Tol = DefaultGeometryTolerance>
+class RotationMatrix3 {
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "Rotation matrix numeric type must be IEEE float compliant.");
+
+ public:
+  using value_type = T;
+  using tolerance_type = Tol;
+
+  RotationMatrix3() = delete;
+
+  /**
+   * @brief Constructor for valid rotation matrix objects from the entries in
+   * row-major order.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * RotationMatrix3).
+   */
+  explicit RotationMatrix3(const std::array<T, 9>& m) : m_(m) {
+    DEFAULT_ENFORCE(RotationMatrix3::check(m_));
+  }
+
+  /**
+   * @brief Trusted constructor for entries already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'm'. This is only
+   * enforced at the AUDIT build level.
+   */
+  RotationMatrix3(const std::array<T, 9>& m, assume_valid_t) : m_(m) {
+    AUDIT_ENFORCE(RotationMatrix3::check(m_));
+  }
+
+  /**
+   * @brief Rotation matrix of a unit quaternion.
+   *
+   * @note The entries are scaled by the inverse squared norm of 'q', so the
+   * result is orthonormal up to rounding error even though 'q' only has unit
+   * norm within tolerance.
+   */
+  explicit RotationMatrix3(const UnitQuaternion<T, Tol>& q)
+      : RotationMatrix3(from_quaternion(q), assume_valid) {}
+
+  /** @brief The identity rotation. */
+  static RotationMatrix3 identity() {
+    const auto o = static_cast<T>(0);
+    const auto l = static_cast<T>(1);
+    return RotationMatrix3(std::array<T, 9>{{l, o, o, o, l, o, o, o, l}},
+                           assume_valid);
+  }
+
+  /** @brief Entry at row 'i' and column 'j'. */
+  T operator()(std::size_t i, std::size_t j) const { return m_[3 * i + j]; }
+
+  /** @brief The entries in row-major order. */
+  const std::array<T, 9>& array() const { return m_; }
+
+  /** @brief Inverse rotation (transposition preserves the invariant). */
+  RotationMatrix3 transpose() const {
+    return RotationMatrix3(std::array<T, 9>{{m_[0], m_[3], m_[6], m_[1], m_[4],
+                                             m_[7], m_[2], m_[5], m_[8]}},
+                           assume_valid);
+  }
+
+  /** @brief Composition of rotations, re-orthonormalized. */
+  RotationMatrix3 operator*(const RotationMatrix3& other) const {
+    std::array<T, 9> m;
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t j = 0; j < 3; ++j) {
+        m[3 * i + j] = m_[3 * i] * other.m_[j] +
+                       m_[3 * i + 1] * other.m_[3 + j] +
+                       m_[3 * i + 2] * other.m_[6 + j];
+      }
+    }
+    orthonormalize(m);
+    return RotationMatrix3(m, assume_valid);
+  }
+
+  /** @brief Rotate a unit vector, renormalizing the result. */
+  UnitVector3<T, Tol> operator*(const UnitVector3<T, Tol>& v) const {
+    const auto& a = v.array();
+    std::array<T, 3> r{{array_checks::dot<3>(&m_[0], a.data()),
+                        array_checks::dot<3>(&m_[3], a.data()),
+                        array_checks::dot<3>(&m_[6], a.data())}};
+    array_checks::renormalize<3>(r.data());
+    return UnitVector3<T, Tol>(r[0], r[1], r[2], assume_valid);
+  }
+
+  /** @brief Tolerance on the orthonormality of the rows. */
+  static constexpr T tolerance() { return bounds::value_of<T, Tol>::value(); }
+
+  /** @brief Predicate for the class invariant. */
+  static bool is_valid(const std::array<T, 9>& m) {
+    return array_checks::is_near_orthonormal<3>(m.data(),
+                                                RotationMatrix3::tolerance()) &
+           (determinant(m) > static_cast<T>(0));
+  }
+
+  /** @brief Check enforcing the class invariant. */
+  static ReturnStatus check(const std::array<T, 9>& m) {
+    const auto det = determinant(m);
+    auto comment = CONTRACT_COMMENT(
+        "", "determinant " + gcc_7x_to_string_fix(det) + " must be positive");
+    return array_checks::near_orthonormal<3>(m.data(),
+                                             RotationMatrix3::tolerance()) &&
+           ReturnStatus(std::move(comment), det > static_cast<T>(0));
+  }
+
+  /**
+   * @brief Check the class invariant for 'count' matrices stored as
+   * consecutive row-major blocks of 9 entries in 'data'.
+   *
+   * This is meant for validating external buffers, e.g., before constructing
+   * objects from them with the trusted constructor.
+   */
+  static ReturnStatus check_batch(const T* data, std::size_t count) {
+    bool valid = true;
+    std::array<T, 9> m;
+    for (std::size_t i = 0; i < count; ++i) {
+      for (std::size_t k = 0; k < 9; ++k) {
+        m[k] = data[9 * i + k];
+      }
+      valid &= RotationMatrix3::is_valid(m);
+    }
+    return batch_status(valid, count);
+  }
+
+  /** @brief Re-check the class invariant for an array of 'count' objects. */
+  static ReturnStatus check_batch(const RotationMatrix3* m, std::size_t count) {
+    bool valid = true;
+    for (std::size_t i = 0; i < count; ++i) {
+      valid &= RotationMatrix3::is_valid(m[i].m_);
+    }
+    return batch_status(valid, count);
+  }
+
+ private:
+  static T determinant(const std::array<T, 9>& m) {
+    return m[0] * (m[4] * m[8] - m[5] * m[7]) -
+           m[1] * (m[3] * m[8] - m[5] * m[6]) +
+           m[2] * (m[3] * m[7] - m[4] * m[6]);
+  }
+
+  static ReturnStatus batch_status(bool valid, std::size_t count) {
+    auto comment = CONTRACT_COMMENT(
+        "", valid ? std::string()
+                  : (std::to_string(count) +
+                     " rotation matrices must be valid"));
+    return ReturnStatus(std::move(comment), valid);
+  }
+
+  static std::array<T, 9> from_quaternion(const UnitQuaternion<T, Tol>& q) {
+    const auto w = q.w();
+    const auto x = q.x();
+    const auto y = q.y();
+    const auto z = q.z();
+    const auto s = static_cast<T>(2) / (w * w + x * x + y * y + z * z);
+    const auto l = static_cast<T>(1);
+    return std::array<T, 9>{{l - s * (y * y + z * z), s * (x * y - w * z),
+                             s * (x * z + w * y), s * (x * y + w * z),
+                             l - s * (x * x + z * z), s * (y * z - w * x),
+                             s * (x * z - w * y), s * (y * z + w * x),
+                             l - s * (x * x + y * y)}};
+  }
+
+  /**
+   * @brief Restore the orthonormality of a matrix with nearly orthonormal
+   * rows.
+   *
+   * The error in the orthogonality of the first two rows is split between
+   * them, the third row is replaced by their cross product (which also keeps
+   * the determinant positive), and each row is renormalized.
+   */
+  static void orthonormalize(std::array<T, 9>& m) {
+    T* r0 = &m[0];
+    T* r1 = &m[3];
+    T* r2 = &m[6];
+    const auto half_error =
+        array_checks::dot<3>(r0, r1) * static_cast<T>(0.5);
+    for (std::size_t k = 0; k < 3; ++k) {
+      const auto a = r0[k];
+      const auto b = r1[k];
+      r0[k] = a - half_error * b;
+      r1[k] = b - half_error * a;
+    }
+    r2[0] = r0[1] * r1[2] - r0[2] * r1[1];
+    r2[1] = r0[2] * r1[0] - r0[0] * r1[2];
+    r2[2] = r0[0] * r1[1] - r0[1] * r1[0];
+    array_checks::renormalize<3>(r0);
+    array_checks::renormalize<3>(r1);
+    array_checks::renormalize<3>(r2);
+  }
+
+  std::array<T, 9> m_;
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__ROTATION_MATRIX3_HPP_
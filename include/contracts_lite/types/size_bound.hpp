@@ -19,14 +19,36 @@
 #ifndef CONTRACTS__SIZE_BOUND_HPP_
 #define CONTRACTS__SIZE_BOUND_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/niche_traits.hpp"
 #include "contracts_lite/range_checks.hpp"
 
 namespace contracts_lite {
+/**
+ * @brief Smallest unsigned integer type that can represent 'BOUND'.
+ */
+template <size_t BOUND>
+using size_bound_storage_t = typename std::conditional<
+    (BOUND <= UINT8_MAX), uint8_t,
+    typename std::conditional<
+        (BOUND <= UINT16_MAX), uint16_t,
+        typename std::conditional<(BOUND <= UINT32_MAX), uint32_t,
+                                  size_t>::type>::type>::type;
+
 /**
  * @brief Container for size bounds.
  *
  * @note A size bound is 'valid' if and only if it is in [0, BOUND]
  *
+ * @note The value is stored in the smallest unsigned type that can hold
+ * 'BOUND' (see size_bound_storage_t), so arrays of small bounds are compact.
+ * The interface is in terms of size_t regardless of the storage type.
+ *
  * @invariant The value of these objects is guaranteed to be valid upon
  * successful construction.
  *
@@ -35,6 +57,8 @@ namespace contracts_lite {
 template <size_t BOUND>
 class SizeBound {
  public:
+  using storage_type = size_bound_storage_t<BOUND>;
+
   SizeBound() = delete;
 
   /** @brief Allow objects to be directly cast to size types. */
@@ -46,15 +70,46 @@ class SizeBound {
    * @post The class invariant validity condition holds (see invariant in
    * SizeBound).
    */
-  SizeBound(size_t r) : r_(r) {
-    DEFAULT_ENFORCE(contracts_lite::range_checks::in_range_closed_closed(
-        r_, static_cast<size_t>(0), BOUND));
+  SizeBound(size_t r) : r_(static_cast<storage_type>(r)) {
+    // Check the argument rather than the member, which may have truncated it.
+    DEFAULT_ENFORCE(SizeBound::check(r));
+  }
+
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'r'. This is only
+   * enforced at the AUDIT build level.
+   */
+  SizeBound(size_t r, assume_valid_t) : r_(static_cast<storage_type>(r)) {
+    AUDIT_ENFORCE(SizeBound::check(r));
+  }
+
+  /** @brief Predicate for the class invariant. */
+  static constexpr bool is_valid(size_t r) { return r <= BOUND; }
+
+  /** @brief Range check enforcing the class invariant. */
+  static ReturnStatus check(size_t r) {
+    return contracts_lite::range_checks::in_range_closed_closed(
+        r, static_cast<size_t>(0), BOUND);
   }
 
  private:
-  size_t r_;
+  storage_type r_;
 };
 
+/**
+ * @brief BOUND + 1 is a niche of SizeBound if the storage type can hold it.
+ */
+template <size_t BOUND>
+struct niche_traits<SizeBound<BOUND>>
+    : std::conditional<
+          (BOUND < std::numeric_limits<size_bound_storage_t<BOUND>>::max()),
+          value_niche_traits<size_bound_storage_t<BOUND>,
+                             static_cast<size_bound_storage_t<BOUND>>(BOUND +
+                                                                      1)>,
+          niche_traits<void>>::type {};
+
 }  // namespace contracts_lite
 
 #endif  // CONTRACTS__SIZE_BOUND_HPP_
@@ -23,7 +23,9 @@
 #include <type_traits>
 #include <utility>
 
-#include "contracts_lite/operators.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/niche_traits.hpp"
+#include "contracts_lite/return_status.hpp"
 
 namespace contracts_lite {
 /**
@@ -62,23 +64,41 @@ class StrictlyPositiveOddInteger {
    * StrictlyPositiveOddInteger).
    */
   StrictlyPositiveOddInteger(T r) : r_(r) {
-    DEFAULT_ENFORCE([&]() {
-      const auto is_strictly_positive = (r > static_cast<T>(0));
-      const auto is_not_less_than_min = (r >= Min);
-      const auto is_odd = static_cast<bool>(r & static_cast<T>(1));
-      auto comment = CONTRACT_COMMENT(
-          "", gcc_7x_to_string_fix(r) +
-                  " must be strictly positive, odd, and greater than " +
-                  gcc_7x_to_string_fix(Min) + ".");
-      return contracts_lite::ReturnStatus(
-          std::move(comment),
-          (is_strictly_positive && is_odd && is_not_less_than_min));
-    }());
+    DEFAULT_ENFORCE(StrictlyPositiveOddInteger::check(r_));
+  }
+
+  /**
+   * @brief Trusted constructor for values already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for 'r'. This is only
+   * enforced at the AUDIT build level.
+   */
+  StrictlyPositiveOddInteger(T r, assume_valid_t) : r_(r) {
+    AUDIT_ENFORCE(StrictlyPositiveOddInteger::check(r_));
+  }
+
+  /** @brief Check enforcing the class invariant. */
+  static ReturnStatus check(T r) {
+    // Min is strictly positive, so this also checks that r is. The tests are
+    // combined with '&' rather than '&&', so that the check is one branch.
+    const bool is_not_less_than_min = (r >= Min);
+    const bool is_odd = static_cast<bool>(r & static_cast<T>(1));
+    auto comment = CONTRACT_COMMENT(
+        "", gcc_7x_to_string_fix(r) +
+                " must be strictly positive, odd, and greater than " +
+                gcc_7x_to_string_fix(Min) + ".");
+    return contracts_lite::ReturnStatus(std::move(comment),
+                                        is_not_less_than_min & is_odd);
   }
 
  private:
   T r_;
 };
+
+/** @brief Zero is not strictly positive, so it is a niche. */
+template <typename T, T Min>
+struct niche_traits<StrictlyPositiveOddInteger<T, Min>>
+    : value_niche_traits<T, static_cast<T>(0)> {};
 }  // namespace contracts_lite
 
 #endif  // CONTRACTS__STRICTLY_POSITIVE_ODD_INTEGER_HPP_
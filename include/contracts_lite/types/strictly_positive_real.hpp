@@ -19,9 +19,9 @@
 #ifndef CONTRACTS__STRICTLY_POSITIVE_REAL_HPP_
 #define CONTRACTS__STRICTLY_POSITIVE_REAL_HPP_
 
-#include <limits>
+#include <ratio>
 
-#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
 
 namespace contracts_lite {
 /**
@@ -35,31 +35,8 @@ namespace contracts_lite {
  * @implements{SRD006}
  */
 template <typename T>
-class StrictlyPositiveReal {
-  static_assert(
-      std::numeric_limits<T>::is_iec559,
-      "StrictlyPositiveReal numeric type must be IEEE float compliant.");
-
- public:
-  StrictlyPositiveReal() = delete;
-
-  /** @brief Allow objects to be directly cast to float types. */
-  operator T() const { return r_; }
-
-  /**
-   * @brief Converting constructor for valid strictly positive real objects.
-   *
-   * @post The class invariant validity condition holds (see invariant in
-   * StrictlyPositiveReal).
-   */
-  StrictlyPositiveReal(T r) : r_(r) {
-    DEFAULT_ENFORCE(contracts_lite::range_checks::in_range_open_open(
-        r_, static_cast<T>(0), std::numeric_limits<T>::infinity()));
-  }
-
- private:
-  T r_;
-};
+using StrictlyPositiveReal =
+    BoundedReal<T, std::ratio<0>, bounds::Infinity, interval::OpenOpen>;
 
 }  // namespace contracts_lite
 
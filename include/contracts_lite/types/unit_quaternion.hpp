@@ -0,0 +1,198 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines the unit quaternion type.
+
+#ifndef CONTRACTS__UNIT_QUATERNION_HPP_
+#define CONTRACTS__UNIT_QUATERNION_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "contracts_lite/array_checks.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/unit_vector3.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Container for unit quaternions, i.e., 3D rotations.
+ *
+ * @note A unit quaternion is 'valid' if and only if its squared norm is within
+ * 'Tol' (see the bounds namespace) of one.
+ *
+ * @note Products of unit quaternions are unit quaternions up to rounding error,
+ * so operations renormalize their results and construct them with the trusted
+ * constructor. The invariant is then only re-checked at the AUDIT build level.
+ *
+ * @invariant The components of these objects are guaranteed to be valid upon
+ * successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, typename Tol = DefaultGeometryTolerance>
+class UnitQuaternion {
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "Unit quaternion numeric type must be IEEE float compliant.");
+
+ public:
+  using value_type = T;
+  using tolerance_type = Tol;
+
+  UnitQuaternion() = delete;
+
+  /**
+   * @brief Constructor for valid unit quaternion objects from the scalar part
+   * 'w' and the vector part (x, y, z).
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * UnitQuaternion).
+   */
+  UnitQuaternion(T w, T x, T y, T z) : q_{{w, x, y, z}} {
+    DEFAULT_ENFORCE(UnitQuaternion::check(q_));
+  }
+
+  /**
+   * @brief Trusted constructor for components already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for the components. This
+   * is only enforced at the AUDIT build level.
+   */
+  UnitQuaternion(T w, T x, T y, T z, assume_valid_t) : q_{{w, x, y, z}} {
+    AUDIT_ENFORCE(UnitQuaternion::check(q_));
+  }
+
+  /** @brief The identity rotation. */
+  static UnitQuaternion identity() {
+    return UnitQuaternion(static_cast<T>(1), static_cast<T>(0),
+                          static_cast<T>(0), static_cast<T>(0), assume_valid);
+  }
+
+  /**
+   * @brief Rotation by 'angle' radians about 'axis'.
+   *
+   * @pre The angle is finite, as enforced by Real on conversion.
+   */
+  static UnitQuaternion from_axis_angle(const UnitVector3<T, Tol>& axis,
+                                        Real<T> angle) {
+    const auto half = static_cast<T>(angle) * static_cast<T>(0.5);
+    const auto s = std::sin(half);
+    std::array<T, 4> q{{std::cos(half), s * axis.x(), s * axis.y(),
+                        s * axis.z()}};
+    array_checks::renormalize<4>(q.data());
+    return UnitQuaternion(q, assume_valid);
+  }
+
+  T w() const { return q_[0]; }
+  T x() const { return q_[1]; }
+  T y() const { return q_[2]; }
+  T z() const { return q_[3]; }
+
+  /** @brief The components (w, x, y, z) as an array. */
+  const std::array<T, 4>& array() const { return q_; }
+
+  /** @brief Inverse rotation (conjugation preserves the norm exactly). */
+  UnitQuaternion conjugate() const {
+    return UnitQuaternion(q_[0], -q_[1], -q_[2], -q_[3], assume_valid);
+  }
+
+  /** @brief Composition of rotations (Hamilton product), renormalized. */
+  UnitQuaternion operator*(const UnitQuaternion& other) const {
+    const auto& a = q_;
+    const auto& b = other.q_;
+    std::array<T, 4> q{{a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3],
+                        a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2],
+                        a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1],
+                        a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0]}};
+    array_checks::renormalize<4>(q.data());
+    return UnitQuaternion(q, assume_valid);
+  }
+
+  /** @brief Rotate a unit vector, renormalizing the result. */
+  UnitVector3<T, Tol> rotate(const UnitVector3<T, Tol>& v) const {
+    // v' = v + 2 w (u x v) + 2 u x (u x v), with u the vector part.
+    const auto w = q_[0];
+    const auto ux = q_[1];
+    const auto uy = q_[2];
+    const auto uz = q_[3];
+    const auto tx = static_cast<T>(2) * (uy * v.z() - uz * v.y());
+    const auto ty = static_cast<T>(2) * (uz * v.x() - ux * v.z());
+    const auto tz = static_cast<T>(2) * (ux * v.y() - uy * v.x());
+    std::array<T, 3> r{{v.x() + w * tx + (uy * tz - uz * ty),
+                        v.y() + w * ty + (uz * tx - ux * tz),
+                        v.z() + w * tz + (ux * ty - uy * tx)}};
+    array_checks::renormalize<3>(r.data());
+    return UnitVector3<T, Tol>(r[0], r[1], r[2], assume_valid);
+  }
+
+  /** @brief Tolerance on the squared norm. */
+  static constexpr T tolerance() { return bounds::value_of<T, Tol>::value(); }
+
+  /** @brief Predicate for the class invariant. */
+  static bool is_valid(const std::array<T, 4>& q) {
+    return array_checks::is_near(array_checks::squared_norm<4>(q.data()),
+                                 static_cast<T>(1),
+                                 UnitQuaternion::tolerance());
+  }
+
+  /** @brief Check enforcing the class invariant. */
+  static ReturnStatus check(const std::array<T, 4>& q) {
+    return array_checks::near(array_checks::squared_norm<4>(q.data()),
+                              static_cast<T>(1), UnitQuaternion::tolerance());
+  }
+
+  /**
+   * @brief Check the class invariant for 'count' quaternions stored as
+   * consecutive (w, x, y, z) quadruples in 'data'.
+   *
+   * This is meant for validating external buffers, e.g., before constructing
+   * objects from them with the trusted constructor.
+   */
+  static ReturnStatus check_batch(const T* data, std::size_t count) {
+    return array_checks::near_unit_norm<4>(data, count,
+                                           UnitQuaternion::tolerance());
+  }
+
+  /** @brief Re-check the class invariant for an array of 'count' objects. */
+  static ReturnStatus check_batch(const UnitQuaternion* q, std::size_t count) {
+    bool valid = true;
+    for (std::size_t i = 0; i < count; ++i) {
+      valid &= UnitQuaternion::is_valid(q[i].q_);
+    }
+    auto comment = CONTRACT_COMMENT(
+        "", valid ? std::string()
+                  : (std::to_string(count) +
+                     " unit quaternions must be valid"));
+    return ReturnStatus(std::move(comment), valid);
+  }
+
+ private:
+  UnitQuaternion(const std::array<T, 4>& q, assume_valid_t) : q_(q) {
+    AUDIT_ENFORCE(UnitQuaternion::check(q_));
+  }
+
+  std::array<T, 4> q_;
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__UNIT_QUATERNION_HPP_
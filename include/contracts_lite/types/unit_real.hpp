@@ -19,10 +19,10 @@
 #ifndef CONTRACTS__UNIT_REAL_H_
 #define CONTRACTS__UNIT_REAL_H_
 
-#include <limits>
+#include <ratio>
 
-#include <contracts_lite/range_checks.hpp>
 #include <contracts_lite/simple_violation_handler.hpp>
+#include <contracts_lite/types/bounded_real.hpp>
 
 namespace contracts_lite {
 /**
@@ -36,31 +36,8 @@ namespace contracts_lite {
  * @implements{SRD006}
  */
 template <typename T>
-class UnitReal {
-  static_assert(std::numeric_limits<T>::is_iec559,
-                "Unit real numeric type must be IEEE float compliant.");
-
- public:
-  UnitReal() = delete;
-
-  /** @brief Allow objects to be directly cast to float types. */
-  operator T() const { return r_; }
-
-  /**
-   * @brief Converting constructor for valid unit real objects.
-   *
-   * @post The the class invariant validity condition holds (see invariant in
-   * UnitReal).
-   */
-  UnitReal(T r) : r_(r) {
-    auto in_range = contracts_lite::range_checks::in_range_closed_closed(
-        r_, static_cast<T>(0), static_cast<T>(1));
-    DEFAULT_ENFORCE(std::move(in_range));
-  }
-
- private:
-  T r_;
-};
+using UnitReal =
+    BoundedReal<T, std::ratio<0>, std::ratio<1>, interval::ClosedClosed>;
 
 }  // namespace contracts_lite
 
@@ -0,0 +1,160 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \copyright Copyright 2021 Mapless AI, Inc.
+/// \file
+/// \brief This file defines the 3D unit vector type.
+
+#ifndef CONTRACTS__UNIT_VECTOR3_HPP_
+#define CONTRACTS__UNIT_VECTOR3_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ratio>
+#include <string>
+#include <utility>
+
+#include "contracts_lite/array_checks.hpp"
+#include "contracts_lite/assume_valid.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+
+namespace contracts_lite {
+
+/**
+ * @brief Default tolerance on the invariants of the geometry types.
+ *
+ * @note This is a bound type (see the bounds namespace), so it may be replaced
+ * by any std::ratio or custom bound.
+ */
+using DefaultGeometryTolerance = std::ratio<1, 100000>;
+
+/**
+ * @brief Container for 3D unit vectors.
+ *
+ * @note A unit vector is 'valid' if and only if its squared norm is within
+ * 'Tol' (see the bounds namespace) of one.
+ *
+ * @invariant The components of these objects are guaranteed to be valid upon
+ * successful construction.
+ *
+ * @implements{SRD006}
+ */
+template <typename T, typename Tol = DefaultGeometryTolerance>
+class UnitVector3 {
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "Unit vector numeric type must be IEEE float compliant.");
+
+ public:
+  using value_type = T;
+  using tolerance_type = Tol;
+
+  UnitVector3() = delete;
+
+  /**
+   * @brief Constructor for valid unit vector objects.
+   *
+   * @post The class invariant validity condition holds (see invariant in
+   * UnitVector3).
+   */
+  UnitVector3(T x, T y, T z) : v_{{x, y, z}} {
+    DEFAULT_ENFORCE(UnitVector3::check(v_));
+  }
+
+  /**
+   * @brief Trusted constructor for components already known to be valid.
+   *
+   * @pre The class invariant validity condition holds for the components. This
+   * is only enforced at the AUDIT build level.
+   */
+  UnitVector3(T x, T y, T z, assume_valid_t) : v_{{x, y, z}} {
+    AUDIT_ENFORCE(UnitVector3::check(v_));
+  }
+
+  /**
+   * @brief Construct the unit vector in the direction of (x, y, z).
+   *
+   * @pre (x, y, z) has a finite, non-zero norm. This is enforced at the
+   * DEFAULT build level through the class invariant.
+   */
+  static UnitVector3 normalize(T x, T y, T z) {
+    const auto norm = std::sqrt(x * x + y * y + z * z);
+    return UnitVector3(x / norm, y / norm, z / norm);
+  }
+
+  T x() const { return v_[0]; }
+  T y() const { return v_[1]; }
+  T z() const { return v_[2]; }
+  T operator[](std::size_t i) const { return v_[i]; }
+
+  /** @brief The components as an array. */
+  const std::array<T, 3>& array() const { return v_; }
+
+  /** @brief Dot product, i.e., the cosine of the angle between the vectors. */
+  T dot(const UnitVector3& other) const {
+    return array_checks::dot<3>(v_.data(), other.v_.data());
+  }
+
+  /** @brief Opposite vector (negation preserves the norm exactly). */
+  UnitVector3 operator-() const {
+    return UnitVector3(-v_[0], -v_[1], -v_[2], assume_valid);
+  }
+
+  /** @brief Tolerance on the squared norm. */
+  static constexpr T tolerance() { return bounds::value_of<T, Tol>::value(); }
+
+  /** @brief Predicate for the class invariant. */
+  static bool is_valid(const std::array<T, 3>& v) {
+    return array_checks::is_near(array_checks::squared_norm<3>(v.data()),
+                                 static_cast<T>(1), UnitVector3::tolerance());
+  }
+
+  /** @brief Check enforcing the class invariant. */
+  static ReturnStatus check(const std::array<T, 3>& v) {
+    return array_checks::near(array_checks::squared_norm<3>(v.data()),
+                              static_cast<T>(1), UnitVector3::tolerance());
+  }
+
+  /**
+   * @brief Check the class invariant for 'count' vectors stored as consecutive
+   * (x, y, z) triples in 'data'.
+   *
+   * This is meant for validating external buffers, e.g., before constructing
+   * objects from them with the trusted constructor.
+   */
+  static ReturnStatus check_batch(const T* data, std::size_t count) {
+    return array_checks::near_unit_norm<3>(data, count,
+                                           UnitVector3::tolerance());
+  }
+
+  /** @brief Re-check the class invariant for an array of 'count' objects. */
+  static ReturnStatus check_batch(const UnitVector3* v, std::size_t count) {
+    bool valid = true;
+    for (std::size_t i = 0; i < count; ++i) {
+      valid &= UnitVector3::is_valid(v[i].v_);
+    }
+    auto comment = CONTRACT_COMMENT(
+        "", valid ? std::string()
+                  : (std::to_string(count) + " unit vectors must be valid"));
+    return ReturnStatus(std::move(comment), valid);
+  }
+
+ private:
+  std::array<T, 3> v_;
+};
+
+}  // namespace contracts_lite
+
+#endif  // CONTRACTS__UNIT_VECTOR3_HPP_
@@ -0,0 +1,60 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file codegen_bounded_real.cpp
+ * Functions whose generated code is checked against codegen_bounded_real.spec.
+ * The bounds of each type are compile-time constants, so each invariant must
+ * compile to at most two compares and no calls.
+ */
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/acute_degree.hpp"
+#include "contracts_lite/types/acute_radian.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+
+namespace c = contracts_lite;
+
+extern "C" {
+
+bool codegen_real_is_valid(float r) { return c::Real<float>::is_valid(r); }
+
+bool codegen_unit_real_is_valid(float r) {
+  return c::UnitReal<float>::is_valid(r);
+}
+
+bool codegen_nonnegative_real_is_valid(float r) {
+  return c::NonnegativeReal<float>::is_valid(r);
+}
+
+bool codegen_strictly_positive_real_is_valid(float r) {
+  return c::StrictlyPositiveReal<float>::is_valid(r);
+}
+
+bool codegen_acute_degree_is_valid(float r) {
+  return c::AcuteDegree<float>::is_valid(r);
+}
+
+bool codegen_acute_radian_is_valid(float r) {
+  return c::AcuteRadian<float>::is_valid(r);
+}
+
+bool codegen_acute_radian_is_valid_double(double r) {
+  return c::AcuteRadian<double>::is_valid(r);
+}
+
+}  // extern "C"
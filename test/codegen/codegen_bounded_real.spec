@@ -0,0 +1,15 @@
+# Bound checks with compile-time bounds: one or two compares, no calls.
+codegen_real_is_valid                     max_compares 2
+codegen_real_is_valid                     no_calls
+codegen_unit_real_is_valid                max_compares 2
+codegen_unit_real_is_valid                no_calls
+codegen_nonnegative_real_is_valid         max_compares 2
+codegen_nonnegative_real_is_valid         no_calls
+codegen_strictly_positive_real_is_valid   max_compares 2
+codegen_strictly_positive_real_is_valid   no_calls
+codegen_acute_degree_is_valid             max_compares 2
+codegen_acute_degree_is_valid             no_calls
+codegen_acute_radian_is_valid             max_compares 2
+codegen_acute_radian_is_valid             no_calls
+codegen_acute_radian_is_valid_double      max_compares 2
+codegen_acute_radian_is_valid_double      no_calls
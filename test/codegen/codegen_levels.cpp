@@ -0,0 +1,125 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file codegen_levels.cpp
+ * Functions whose generated code is checked at each build level, against
+ * codegen_levels_off.spec, codegen_levels_default.spec and
+ * codegen_levels_audit.spec. Each function using contracts has a hand-written
+ * equivalent without contracts ('codegen_raw_*'), which it must match with
+ * contracts OFF. At the other levels, the specs bound the code the checks add.
+ */
+
+#include <array>
+#include <cstddef>
+
+#include "contracts_lite/batch_enforcement.hpp"
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/covariance_matrix.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "contracts_lite/types/unit_vector3.hpp"
+
+namespace c = contracts_lite;
+
+namespace {
+
+/**
+ * @brief Matrix without contracts. GCC keeps the copy of an array member that
+ * is only partially read, so the equivalent of a matrix type must copy too.
+ */
+struct Matrix3 {
+  explicit Matrix3(const std::array<double, 9>& m) : m(m) {}
+  std::array<double, 9> m;
+};
+
+}  // namespace
+
+extern "C" {
+
+float codegen_levels_enforce(float x) {
+  DEFAULT_ENFORCE(c::range_checks::in_range_closed_closed(x, 0.0f, 1.0f));
+  return 2.0f * x;
+}
+
+float codegen_raw_enforce(float x) { return 2.0f * x; }
+
+float codegen_levels_audit_enforce(float x) {
+  AUDIT_ENFORCE(c::range_checks::in_range_closed_closed(x, 0.0f, 1.0f));
+  return 2.0f * x;
+}
+
+float codegen_levels_unit_real_lerp(float a, float b, float t) {
+  const c::UnitReal<float> u(t);
+  return a + (b - a) * u;
+}
+
+float codegen_raw_unit_real_lerp(float a, float b, float t) {
+  return a + (b - a) * t;
+}
+
+float codegen_levels_reciprocal(float x) {
+  return 1.0f / c::StrictlyPositiveReal<float>(x);
+}
+
+float codegen_raw_reciprocal(float x) { return 1.0f / x; }
+
+float codegen_levels_size_bound_lookup(const float* table, std::size_t i) {
+  const c::SizeBound<255> index(i);
+  return table[index];
+}
+
+float codegen_raw_size_bound_lookup(const float* table, std::size_t i) {
+  return table[static_cast<unsigned char>(i)];
+}
+
+float codegen_levels_unit_vector3_dot(float x, float y, float z) {
+  const c::UnitVector3<float> v(x, y, z);
+  return v.x() * 0.5f + v.y() * 0.25f + v.z() * 0.25f;
+}
+
+float codegen_raw_unit_vector3_dot(float x, float y, float z) {
+  return x * 0.5f + y * 0.25f + z * 0.25f;
+}
+
+double codegen_levels_covariance_trace(const std::array<double, 9>& m) {
+  const c::CovarianceMatrix<double, 3> covariance(m);
+  const auto& a = covariance.array();
+  return a[0] + a[4] + a[8];
+}
+
+double codegen_raw_covariance_trace(const std::array<double, 9>& m) {
+  const Matrix3 copy(m);
+  return copy.m[0] + copy.m[4] + copy.m[8];
+}
+
+void codegen_levels_batch_scale(float* y, const float* x, std::size_t n) {
+  DEFAULT_ENFORCE_BATCH(batch, [x](std::size_t i) {
+    return c::UnitReal<float>::check(x[i]);
+  });
+  for (std::size_t i = 0; i < n; ++i) {
+    batch.expect(c::UnitReal<float>::is_valid(x[i]));
+    y[i] = 2.0f * x[i];
+  }
+}
+
+void codegen_raw_batch_scale(float* y, const float* x, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    y[i] = 2.0f * x[i];
+  }
+}
+
+}  // extern "C"
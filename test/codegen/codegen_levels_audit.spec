@@ -0,0 +1,17 @@
+# At the AUDIT build level, checks build their (informative) comments, so only
+# the code size is bounded, about 10% over the current code.
+codegen_levels_enforce                    max_instructions 30
+codegen_levels_enforce                    max_bytes 122
+codegen_levels_audit_enforce              same_as codegen_levels_enforce
+codegen_levels_unit_real_lerp             max_instructions 42
+codegen_levels_unit_real_lerp             max_bytes 170
+codegen_levels_reciprocal                 max_instructions 431
+codegen_levels_reciprocal                 max_bytes 2219
+codegen_levels_size_bound_lookup          max_instructions 528
+codegen_levels_size_bound_lookup          max_bytes 2737
+codegen_levels_unit_vector3_dot           max_instructions 55
+codegen_levels_unit_vector3_dot           max_bytes 245
+codegen_levels_covariance_trace           max_instructions 36
+codegen_levels_covariance_trace           max_bytes 167
+codegen_levels_batch_scale                max_instructions 41
+codegen_levels_batch_scale                max_bytes 140
@@ -0,0 +1,35 @@
+# At the DEFAULT build level, a passing check costs its compares and a branch
+# to the violation path, which is out of line ('.cold'): no strings or streams
+# on the hot path. The budgets are about 10% over the current code, so that
+# growth fails the test.
+codegen_levels_enforce                    no_calls
+codegen_levels_enforce                    no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_enforce                    max_instructions 24
+codegen_levels_enforce                    max_bytes 88
+codegen_levels_audit_enforce              same_as codegen_raw_enforce
+codegen_levels_unit_real_lerp             no_calls
+codegen_levels_unit_real_lerp             no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_unit_real_lerp             max_instructions 27
+codegen_levels_unit_real_lerp             max_bytes 96
+codegen_levels_reciprocal                 no_calls
+codegen_levels_reciprocal                 no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_reciprocal                 max_instructions 27
+codegen_levels_reciprocal                 max_bytes 99
+codegen_levels_size_bound_lookup          no_calls
+codegen_levels_size_bound_lookup          no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_size_bound_lookup          max_instructions 17
+codegen_levels_size_bound_lookup          max_bytes 66
+codegen_levels_unit_vector3_dot           no_calls
+codegen_levels_unit_vector3_dot           no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_unit_vector3_dot           max_instructions 44
+codegen_levels_unit_vector3_dot           max_bytes 175
+# The Cholesky factorization of the check calls sqrt.
+codegen_levels_covariance_trace           no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_covariance_trace           max_instructions 232
+codegen_levels_covariance_trace           max_bytes 1180
+# A batch of checks costs a branch-free update of its failure mask per element,
+# and a single test of the mask after the loop. The only call, before the
+# loop, counts the exceptions in flight when the batch is created.
+codegen_levels_batch_scale                no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_batch_scale                max_instructions 41
+codegen_levels_batch_scale                max_bytes 140
@@ -0,0 +1,12 @@
+# With contracts OFF, checked code must be the same as hand-written code
+# without contracts, and must not touch strings or streams.
+codegen_levels_enforce                    same_as codegen_raw_enforce
+codegen_levels_audit_enforce              same_as codegen_raw_enforce
+codegen_levels_unit_real_lerp             same_as codegen_raw_unit_real_lerp
+codegen_levels_reciprocal                 same_as codegen_raw_reciprocal
+codegen_levels_size_bound_lookup          same_as codegen_raw_size_bound_lookup
+codegen_levels_unit_vector3_dot           same_as codegen_raw_unit_vector3_dot
+codegen_levels_covariance_trace           same_as codegen_raw_covariance_trace
+codegen_levels_covariance_trace           no_calls
+codegen_levels_covariance_trace           no_symbol basic_string|ostream|ios_base|cout|cerr|to_string
+codegen_levels_batch_scale                same_as codegen_raw_batch_scale
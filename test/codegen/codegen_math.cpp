@@ -0,0 +1,46 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file codegen_math.cpp
+ * Functions whose generated code is checked against codegen_math.spec.
+ * Square roots of contract types must compile to the square root instruction,
+ * without the compare and libm fallback call of std::sqrt.
+ */
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/math.hpp"
+
+namespace c = contracts_lite;
+
+extern "C" {
+
+float codegen_math_sqrt_nonnegative_float(c::NonnegativeReal<float> x) {
+  return c::sqrt(x);
+}
+
+double codegen_math_sqrt_strictly_positive_double(
+    c::StrictlyPositiveReal<double> x) {
+  return c::sqrt(x);
+}
+
+float codegen_math_sqrt_unit_real(c::UnitReal<float> x) { return c::sqrt(x); }
+
+/** @brief Euclidean norm: the squared norm is non-negative by construction. */
+float codegen_math_norm(float x, float y) {
+  const c::NonnegativeReal<float> n2(x * x + y * y, c::assume_valid);
+  return c::sqrt(n2);
+}
+
+}  // extern "C"
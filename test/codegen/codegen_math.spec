@@ -0,0 +1,9 @@
+# A square root of a contract type is the instruction alone.
+codegen_math_sqrt_nonnegative_float            max_compares 0
+codegen_math_sqrt_nonnegative_float            no_calls
+codegen_math_sqrt_strictly_positive_double     max_compares 0
+codegen_math_sqrt_strictly_positive_double     no_calls
+codegen_math_sqrt_unit_real                    max_compares 0
+codegen_math_sqrt_unit_real                    no_calls
+codegen_math_norm                              max_compares 0
+codegen_math_norm                              no_calls
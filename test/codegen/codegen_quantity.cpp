@@ -0,0 +1,66 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file codegen_quantity.cpp
+ * Functions whose generated code is checked against codegen_quantity.spec.
+ * With contracts OFF, each function on quantities must compile to the same
+ * instructions as the equivalent function on raw floats.
+ */
+
+#include <ratio>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/quantity.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+
+namespace c = contracts_lite;
+namespace u = contracts_lite::units;
+
+namespace {
+
+using Distance = u::Meters<c::NonnegativeReal<float>>;
+using Duration = u::Seconds<c::StrictlyPositiveReal<float>>;
+
+}  // namespace
+
+extern "C" {
+
+float codegen_quantity_total_meters(float a_m, float b_mm) {
+  const auto total = Distance(a_m) + u::Millimeters<>(b_mm);
+  return total.count_in<std::ratio<1>>();
+}
+
+float codegen_raw_total_meters(float a_m, float b_mm) {
+  return (a_m * 1000.0f + b_mm) * 0.001f;
+}
+
+float codegen_quantity_speed(float distance_mm, float duration_ns) {
+  const u::MetersPerSecond<> v = Distance(u::Millimeters<>(distance_mm)) /
+                                 Duration(u::Nanoseconds<>(duration_ns));
+  return v.count();
+}
+
+float codegen_raw_speed(float distance_mm, float duration_ns) {
+  return (distance_mm * 0.001f) / (duration_ns * 1e-9f);
+}
+
+bool codegen_quantity_less(float a_m, float b_mm) {
+  return Distance(a_m) < u::Millimeters<>(b_mm);
+}
+
+bool codegen_raw_less(float a_m, float b_mm) { return a_m * 1000.0f < b_mm; }
+
+}  // extern "C"
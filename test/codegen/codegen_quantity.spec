@@ -0,0 +1,4 @@
+# Quantities with contracts OFF: the same code as raw float arithmetic.
+codegen_quantity_total_meters             same_as codegen_raw_total_meters
+codegen_quantity_speed                    same_as codegen_raw_speed
+codegen_quantity_less                     same_as codegen_raw_less
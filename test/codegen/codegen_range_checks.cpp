@@ -0,0 +1,54 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file codegen_range_checks.cpp
+ * Functions whose generated code is checked against codegen_range_checks.spec
+ * at the DEFAULT build level: range checks compile to code without branches of
+ * their own, with a single unsigned compare for integers.
+ */
+
+#include <cstddef>
+
+#include "contracts_lite/range_checks.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/strictly_positive_odd_integer.hpp"
+
+namespace c = contracts_lite;
+namespace rc = contracts_lite::range_checks;
+
+extern "C" {
+
+bool codegen_range_checks_float(float x, float lo, float hi) {
+  return rc::in_range_closed_closed(x, lo, hi).status;
+}
+
+bool codegen_range_checks_int(int x) {
+  return rc::in_range_closed_open(x, -10, 100).status;
+}
+
+bool codegen_range_checks_int_runtime_bounds(int x, int lo, int hi) {
+  return rc::in_range_closed_open(x, lo, hi).status;
+}
+
+int codegen_range_checks_odd_integer(int x) {
+  return c::StrictlyPositiveOddInteger<int, 3>(x);
+}
+
+std::size_t codegen_range_checks_size_bound(std::size_t i) {
+  return c::SizeBound<1000>(i);
+}
+
+}  // extern "C"
@@ -0,0 +1,17 @@
+# The range checks have no branches of their own: floats compare both bounds
+# and combine the results, and integers compare the offset from the lower
+# bound with the width of the interval, unsigned.
+codegen_range_checks_float                max_branches 0
+codegen_range_checks_float                max_compares 2
+codegen_range_checks_int                  max_branches 0
+codegen_range_checks_int                  max_compares 1
+# With bounds known only at run time, the bounds are also compared with each
+# other, for empty intervals (in loops, this test is loop-invariant).
+codegen_range_checks_int_runtime_bounds   max_branches 0
+codegen_range_checks_int_runtime_bounds   max_compares 2
+# Enforcing a check is a single branch to the violation path.
+codegen_range_checks_odd_integer          max_branches 1
+codegen_range_checks_odd_integer          no_calls
+codegen_range_checks_size_bound           max_branches 1
+codegen_range_checks_size_bound           max_compares 1
+codegen_range_checks_size_bound           no_calls
@@ -0,0 +1,68 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file codegen_ranged.cpp
+ * Functions whose generated code is checked against codegen_ranged.spec.
+ * Narrowing a Ranged value whose interval is provably inside the target range
+ * must compile to the arithmetic alone, with no compares and no calls.
+ */
+
+#include <cstddef>
+#include <ratio>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/acute_degree.hpp"
+#include "contracts_lite/types/ranged.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+
+namespace c = contracts_lite;
+
+namespace {
+
+using Unit = c::Ranged<float, std::ratio<0>, std::ratio<1>>;
+using Index = c::Ranged<std::size_t, std::ratio<0>, std::ratio<15>>;
+
+}  // namespace
+
+extern "C" {
+
+float codegen_ranged_product_to_unit_real(c::UnitReal<float> a,
+                                          c::UnitReal<float> b) {
+  return c::narrow<c::UnitReal<float>>(Unit(a) * Unit(b));
+}
+
+float codegen_ranged_mean_to_unit_real(c::UnitReal<float> a,
+                                       c::UnitReal<float> b) {
+  using Half = c::Ranged<float, std::ratio<1, 2>, std::ratio<1, 2>>;
+  return c::narrow<c::UnitReal<float>>((Unit(a) + Unit(b)) *
+                                       Half(0.5f, c::assume_valid));
+}
+
+float codegen_ranged_scale_to_acute_degree(c::UnitReal<float> a) {
+  using Scale = c::Ranged<float, std::ratio<89>, std::ratio<89>>;
+  return c::narrow<c::AcuteDegree<float>>(Unit(a) *
+                                          Scale(89.0f, c::assume_valid));
+}
+
+std::size_t codegen_ranged_index_to_size_bound(std::size_t row,
+                                               std::size_t column) {
+  using Stride = c::Ranged<std::size_t, std::ratio<16>, std::ratio<16>>;
+  const Index i(row, c::assume_valid);
+  const Index j(column, c::assume_valid);
+  return c::narrow<c::SizeBound<255>>(i * Stride(16, c::assume_valid) + j);
+}
+
+}  // extern "C"
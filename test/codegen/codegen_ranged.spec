@@ -0,0 +1,9 @@
+# Narrowing into a range that provably contains the result: no checks left.
+codegen_ranged_product_to_unit_real       max_compares 0
+codegen_ranged_product_to_unit_real       no_calls
+codegen_ranged_mean_to_unit_real          max_compares 0
+codegen_ranged_mean_to_unit_real          no_calls
+codegen_ranged_scale_to_acute_degree      max_compares 0
+codegen_ranged_scale_to_acute_degree      no_calls
+codegen_ranged_index_to_size_bound        max_compares 0
+codegen_ranged_index_to_size_bound        no_calls
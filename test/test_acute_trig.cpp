@@ -0,0 +1,169 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define _USE_MATH_DEFINES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/acute_trig.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+/** @brief Number of evenly spaced angles at which errors are measured. */
+constexpr int SAMPLES = 1 << 16;
+
+/** @brief Error of 'r' in units of the last place of 'T' at 'reference'. */
+template <typename T>
+double ulp_error(T r, long double reference) {
+  const auto rounded = static_cast<T>(reference);
+  const auto next =
+      std::nextafter(std::fabs(rounded), std::numeric_limits<T>::infinity());
+  const auto ulp = static_cast<long double>(next) - std::fabs(rounded);
+  return static_cast<double>(std::fabs(r - reference) / ulp);
+}
+
+/** @brief Maximum errors of sin, cos and tan. */
+struct MaxErrors {
+  double sin = 0.0;
+  double cos = 0.0;
+  double tan = 0.0;
+
+  template <typename T>
+  void add(const c::SinCos<T>& sc, T tan_value, long double s, long double c) {
+    sin = std::max(sin, ulp_error(sc.sin, s));
+    cos = std::max(cos, ulp_error(sc.cos, c));
+    tan = std::max(tan, ulp_error(tan_value, s / c));
+  }
+};
+
+/** @brief The i-th of SAMPLES + 1 angles spanning [0, max], inclusive. */
+template <typename T>
+T sample(int i, T max) {
+  return (i == SAMPLES) ? max
+                        : static_cast<T>(static_cast<long double>(max) * i /
+                                         SAMPLES);
+}
+
+template <typename T>
+MaxErrors radian_errors() {
+  MaxErrors e;
+  for (int i = 0; i <= SAMPLES; ++i) {
+    const c::AcuteRadian<T> x(sample(i, c::AcuteRadian<T>::max_value()));
+    const long double xl = static_cast<T>(x);
+    EXPECT_EQ(c::sin(x), c::sincos(x).sin);
+    EXPECT_EQ(c::cos(x), c::sincos(x).cos);
+    e.add(c::sincos(x), c::tan(x), std::sin(xl), std::cos(xl));
+  }
+  return e;
+}
+
+template <typename T>
+MaxErrors degree_errors() {
+  // Reflect the reference exactly too, since pi/2 - x loses the precision of
+  // a long double reference near 90 degrees.
+  const long double k = static_cast<long double>(M_PI) / 180.0L;
+  MaxErrors e;
+  for (int i = 0; i <= SAMPLES; ++i) {
+    const c::AcuteDegree<T> d(sample(i, c::AcuteDegree<T>::max_value()));
+    const bool reflected = (d > static_cast<T>(45));
+    const long double dl = static_cast<T>(d);
+    const long double y = (reflected ? 90.0L - dl : dl) * k;
+    const long double s = reflected ? std::cos(y) : std::sin(y);
+    const long double co = reflected ? std::sin(y) : std::cos(y);
+    EXPECT_EQ(c::sin(d), c::sincos(d).sin);
+    EXPECT_EQ(c::cos(d), c::sincos(d).cos);
+    e.add(c::sincos(d), c::tan(d), s, co);
+  }
+  return e;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AcuteTrig, exact_values) {
+  EXPECT_EQ(c::sin(c::AcuteRadian<float>(0.0f)), 0.0f);
+  EXPECT_EQ(c::cos(c::AcuteRadian<float>(0.0f)), 1.0f);
+  EXPECT_EQ(c::tan(c::AcuteRadian<double>(0.0)), 0.0);
+  EXPECT_EQ(c::sin(c::AcuteDegree<double>(30.0)), 0.5);
+  EXPECT_EQ(c::cos(c::AcuteDegree<double>(60.0)), 0.5);
+  EXPECT_EQ(c::tan(c::AcuteDegree<float>(45.0f)), 1.0f);
+
+  // The largest angles have a finite tangent.
+  EXPECT_TRUE(std::isfinite(c::tan(
+      c::AcuteRadian<float>(c::AcuteRadian<float>::max_value()))));
+  EXPECT_TRUE(std::isfinite(c::tan(
+      c::AcuteDegree<double>(c::AcuteDegree<double>::max_value()))));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AcuteTrig, float_ulp_error) {
+  const auto rad = radian_errors<float>();
+  EXPECT_LT(rad.sin, 1.0);
+  EXPECT_LT(rad.cos, 1.0);
+  EXPECT_LT(rad.tan, 1.0);
+  const auto deg = degree_errors<float>();
+  EXPECT_LT(deg.sin, 1.0);
+  EXPECT_LT(deg.cos, 1.0);
+  EXPECT_LT(deg.tan, 1.0);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AcuteTrig, double_ulp_error) {
+  const auto rad = radian_errors<double>();
+  EXPECT_LT(rad.sin, 1.0);
+  EXPECT_LT(rad.cos, 1.0);
+  EXPECT_LT(rad.tan, 2.5);
+  const auto deg = degree_errors<double>();
+  EXPECT_LT(deg.sin, 1.0);
+  EXPECT_LT(deg.cos, 1.0);
+  EXPECT_LT(deg.tan, 2.5);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AcuteTrig, batch) {
+  std::vector<c::AcuteRadian<float>> x;
+  for (int i = 0; i < 100; ++i) {
+    x.emplace_back(0.0157f * static_cast<float>(i));
+  }
+  const auto n = x.size();
+  std::vector<float> s(n), co(n), t(n), s2(n), c2(n);
+  c::sin_batch(x.data(), n, s.data());
+  c::cos_batch(x.data(), n, co.data());
+  c::tan_batch(x.data(), n, t.data());
+  c::sincos_batch(x.data(), n, s2.data(), c2.data());
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(s[i], c::sin(x[i]));
+    EXPECT_EQ(co[i], c::cos(x[i]));
+    EXPECT_EQ(t[i], c::tan(x[i]));
+    EXPECT_EQ(s2[i], s[i]);
+    EXPECT_EQ(c2[i], co[i]);
+  }
+
+  const std::vector<c::AcuteDegree<double>> d{0.0, 30.0, 45.0, 89.0};
+  std::vector<double> sd(d.size());
+  c::sin_batch(d.data(), d.size(), sd.data());
+  EXPECT_EQ(sd[1], 0.5);
+}
@@ -0,0 +1,157 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/audit_cache.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+/** @brief Stand-in for an expensive check that counts its evaluations. */
+c::ReturnStatus counted_check(int& calls, bool pass) {
+  ++calls;
+  return c::ReturnStatus(std::string("counted check"), pass);
+}
+
+/** @brief Enforce a counted check on 'object' at a single call site. */
+template <typename Cache>
+void enforce(Cache& cache, const int& object, std::uint64_t version,
+             int& calls, bool pass = true) {
+  AUDIT_ENFORCE_CACHED_IN(cache, object, version,
+                          counted_check(calls, pass));
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AuditCache, hit_after_pass) {
+  c::AuditCache<16> cache;
+  const int table = 0;
+  int calls = 0;
+  enforce(cache, table, 1, calls);
+  enforce(cache, table, 1, calls);
+  enforce(cache, table, 1, calls);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(cache.stats().hits, 2u);
+  EXPECT_EQ(cache.stats().misses, 1u);
+  EXPECT_DOUBLE_EQ(cache.stats().hit_rate(), 2.0 / 3.0);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AuditCache, keyed_on_version_and_object) {
+  c::AuditCache<16> cache;
+  const int table = 0;
+  const int other = 0;
+  int calls = 0;
+  // Each key is looked up again right after it is inserted, since keys of
+  // different objects may share a slot, depending on their addresses.
+  enforce(cache, table, 1, calls);
+  enforce(cache, table, 1, calls);
+  EXPECT_EQ(calls, 1);
+  enforce(cache, table, 2, calls);
+  enforce(cache, table, 2, calls);
+  EXPECT_EQ(calls, 2);
+  enforce(cache, other, 2, calls);
+  enforce(cache, other, 2, calls);
+  EXPECT_EQ(calls, 3);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AuditCache, keyed_on_call_site) {
+  c::AuditCache<16> cache;
+  const int table = 0;
+  int calls = 0;
+  enforce(cache, table, 1, calls);
+  AUDIT_ENFORCE_CACHED_IN(cache, table, 1, counted_check(calls, true));
+  EXPECT_EQ(calls, 2);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AuditCache, failures_are_not_cached) {
+  c::AuditCache<16> cache;
+  const int table = 0;
+  int calls = 0;
+  EXPECT_THROW(enforce(cache, table, 1, calls, false), std::runtime_error);
+  EXPECT_THROW(enforce(cache, table, 1, calls, false), std::runtime_error);
+  EXPECT_EQ(calls, 2);
+  EXPECT_EQ(cache.stats().hits, 0u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AuditCache, bounded) {
+  c::AuditCache<1> cache;
+  const int a = 0;
+  const int b = 0;
+  int calls = 0;
+  enforce(cache, a, 1, calls);
+  enforce(cache, b, 1, calls);
+  enforce(cache, a, 1, calls);
+  EXPECT_EQ(calls, 3);
+  cache.clear();
+  enforce(cache, a, 1, calls);
+  EXPECT_EQ(calls, 4);
+  cache.reset_stats();
+  EXPECT_EQ(cache.stats().hits, 0u);
+  EXPECT_EQ(cache.stats().misses, 0u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AuditCache, default_cache) {
+  const int table = 0;
+  int calls = 0;
+  for (int i = 0; i < 4; ++i) {
+    AUDIT_ENFORCE_CACHED(table, 7, counted_check(calls, true));
+  }
+  EXPECT_EQ(calls, 1);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_AuditCache, concurrent_readers) {
+  c::AuditCache<16> cache;
+  const int table = 0;
+  const auto key = cache.key(&table, 1, __FILE__, __LINE__);
+  cache.insert(key);
+  constexpr int threads = 4;
+  constexpr int lookups = 10000;
+  std::vector<std::thread> readers;
+  for (int t = 0; t < threads; ++t) {
+    readers.emplace_back([&cache, key]() {
+      for (int i = 0; i < lookups; ++i) {
+        EXPECT_TRUE(cache.contains(key));
+      }
+    });
+  }
+  for (auto& r : readers) {
+    r.join();
+  }
+  EXPECT_EQ(cache.stats().hits,
+            static_cast<std::uint64_t>(threads) * lookups);
+  EXPECT_EQ(cache.stats().misses, 0u);
+}
@@ -0,0 +1,171 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/batch_enforcement.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+using Unit = c::UnitReal<float>;
+
+/** @brief Line of the batch in scale_units(). */
+constexpr int kBatchLine = __LINE__ + 4;
+
+/** @brief Scale values that must be unit reals, checked as a batch. */
+float scale_units(const std::vector<float>& x) {
+  DEFAULT_ENFORCE_BATCH(batch,
+                        [&](std::size_t i) { return Unit::check(x[i]); });
+  float sum = 0.0f;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    batch.expect(Unit::is_valid(x[i]));
+    sum += 2.0f * x[i];
+  }
+  return sum;
+}
+
+/** @brief Scale values that must be unit reals, checked one by one. */
+float scale_units(const std::vector<float>& x, std::size_t) {
+  float sum = 0.0f;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    DEFAULT_ENFORCE(Unit::check(x[i]));
+    sum += 2.0f * x[i];
+  }
+  return sum;
+}
+
+c::ReturnStatus pass_all(std::size_t) { return c::ReturnStatus("", true); }
+
+c::ReturnStatus fail_all(std::size_t) {
+  return c::ReturnStatus("all fail", false);
+}
+
+/** @brief The what() of the violation of 'f', or an empty string. */
+template <typename F>
+std::string violation(F f) {
+  try {
+    f();
+  } catch (const std::runtime_error& e) {
+    return e.what();
+  }
+  return std::string();
+}
+
+/** @brief Part of a violation description from the comment to the file. */
+std::string comment_to_file(const std::string& what) {
+  return what.substr(0, what.find("\", line_number"));
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_BatchEnforcement, pass) {
+  EXPECT_FLOAT_EQ(scale_units({0.0f, 0.5f, 1.0f}), 3.0f);
+  EXPECT_FLOAT_EQ(scale_units({}), 0.0f);
+}
+
+TEST(Contract_BatchEnforcement, counts) {
+  DEFAULT_ENFORCE_BATCH(batch, pass_all);
+  EXPECT_TRUE(batch.passed());
+  batch.expect(true);
+  batch.expect(true);
+  EXPECT_TRUE(batch.passed());
+  EXPECT_EQ(batch.size(), 2u);
+}
+
+TEST(Contract_BatchEnforcement, same_violation_as_immediate_check) {
+  const std::vector<float> x = {0.5f, 1.0f, 2.0f, -1.0f, 0.0f};
+  const std::string batched = violation([&] { scale_units(x); });
+  const std::string immediate = violation([&] { scale_units(x, 0u); });
+  ASSERT_FALSE(batched.empty());
+  ASSERT_FALSE(immediate.empty());
+  // The first failing element is reported, at the line of the batch.
+  EXPECT_EQ(comment_to_file(batched), comment_to_file(immediate));
+  EXPECT_NE(batched.find("function_name: \"scale_units\""), std::string::npos);
+  EXPECT_NE(batched.find("line_number: \"" + std::to_string(kBatchLine)),
+            std::string::npos);
+}
+
+TEST(Contract_BatchEnforcement, audit) {
+  auto f = [] {
+    AUDIT_ENFORCE_BATCH(batch, [](std::size_t i) {
+      return c::ReturnStatus("element " + std::to_string(i), i != 1u);
+    });
+    for (std::size_t i = 0; i < 3u; ++i) {
+      batch.expect(i != 1u);
+    }
+  };
+  EXPECT_NE(violation(f).find("element 1"), std::string::npos);
+}
+
+TEST(Contract_BatchEnforcement, check_passes_when_evaluated_again) {
+  auto f = [] {
+    DEFAULT_ENFORCE_BATCH(batch, pass_all);
+    batch.expect(false);
+  };
+  EXPECT_NE(violation(f).find("no check failed when evaluated again"),
+            std::string::npos);
+}
+
+TEST(Contract_BatchEnforcement, not_reported_during_unwinding) {
+  auto f = [] {
+    DEFAULT_ENFORCE_BATCH(batch, fail_all);
+    batch.expect(false);
+    throw std::logic_error("unwinding");
+  };
+  EXPECT_THROW(f(), std::logic_error);
+}
+
+TEST(Contract_BatchEnforcement, reported_in_destructor_during_unwinding) {
+  struct BatchInDestructor {
+    std::string* comment;
+    ~BatchInDestructor() {
+      *comment = violation([] {
+        DEFAULT_ENFORCE_BATCH(batch, fail_all);
+        batch.expect(false);
+      });
+    }
+  };
+  std::string comment;
+  try {
+    BatchInDestructor b{&comment};
+    throw std::logic_error("unwinding");
+  } catch (const std::logic_error&) {
+  }
+  EXPECT_NE(comment.find("all fail"), std::string::npos);
+}
+
+TEST(Contract_BatchEnforcement, move) {
+  auto f = [] {
+    DEFAULT_ENFORCE_BATCH(batch, fail_all);
+    batch.expect(false);
+    auto moved = std::move(batch);
+    EXPECT_FALSE(moved.passed());
+    EXPECT_TRUE(batch.passed());
+  };
+  // Only the batch moved to reports the violation.
+  EXPECT_NE(violation(f).find("all fail"), std::string::npos);
+}
@@ -0,0 +1,96 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/bounded_real.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+static constexpr auto NaN = std::numeric_limits<double>::quiet_NaN();
+static constexpr auto INF = std::numeric_limits<double>::infinity();
+
+// (-1, 0.5]
+using HalfOpen = c::BoundedReal<double, std::ratio<-1>, std::ratio<1, 2>,
+                                c::interval::OpenClosed>;
+
+static_assert(HalfOpen::min() == -1.0, "Bound must be a constant expression");
+static_assert(HalfOpen::max() == 0.5, "Bound must be a constant expression");
+static_assert(HalfOpen::is_valid(0.5), "Predicate must be constexpr");
+static_assert(!HalfOpen::is_valid(-1.0), "Predicate must be constexpr");
+static_assert(c::NonnegativeReal<float>::max() ==
+                  std::numeric_limits<float>::infinity(),
+              "Bound must be a constant expression");
+static_assert(std::is_same<c::UnitReal<float>,
+                           c::BoundedReal<float, std::ratio<0>, std::ratio<1>,
+                                          c::interval::ClosedClosed>>::value,
+              "UnitReal must be an alias of BoundedReal");
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, BoundedReal_double) {
+  EXPECT_THROW({ HalfOpen{NaN}; }, std::runtime_error);
+  EXPECT_THROW({ HalfOpen{INF}; }, std::runtime_error);
+  EXPECT_THROW({ HalfOpen{-INF}; }, std::runtime_error);
+  EXPECT_THROW({ HalfOpen{-1.0}; }, std::runtime_error);
+  EXPECT_THROW({ HalfOpen{0.75}; }, std::runtime_error);
+  EXPECT_NO_THROW({ HalfOpen{0.5}; });
+  EXPECT_NO_THROW({ HalfOpen{-0.5}; });
+  EXPECT_THROW(
+      {
+        HalfOpen r{0.0};
+        r = 1.0;
+      },
+      std::runtime_error);
+  EXPECT_NO_THROW({
+    HalfOpen r{0.0};
+    r = 0.25;
+    double tmp = r;
+    r = tmp + 0.25;
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, BoundedReal_assume_valid) {
+  EXPECT_NO_THROW({ HalfOpen(0.25, c::assume_valid); });
+  // Invalid input to the trusted constructor is still caught in AUDIT builds.
+  EXPECT_THROW({ HalfOpen(0.75, c::assume_valid); }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, BoundedReal_violation_site) {
+  // Violations are reported out of line, but name the checking function.
+  try {
+    HalfOpen r{0.75};
+    FAIL() << "Expected a contract violation for " << r;
+  } catch (const std::runtime_error& e) {
+    const std::string what = e.what();
+    EXPECT_NE(what.find("function_name: \"BoundedReal\""), std::string::npos)
+        << what;
+    EXPECT_NE(what.find("0.750000 must be inside the range (-1"),
+              std::string::npos)
+        << what;
+  }
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,93 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/bounded_vector.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+static_assert(
+    std::is_same<decltype(c::BoundedVector<int, 8>{}.size()),
+                 c::SizeBound<8>>::value,
+    "The size of a bounded vector must be a size bound");
+static_assert(sizeof(c::BoundedVector<uint8_t, 15>) == 16,
+              "A small bounded vector must store its size in one byte");
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, BoundedVector_capacity) {
+  c::BoundedVector<int, 3> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_THROW({ v.pop_back(); }, std::runtime_error);
+  EXPECT_NO_THROW({
+    v.push_back(1);
+    v.push_back(2);
+    v.emplace_back(3);
+  });
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW({ v.push_back(4); }, std::runtime_error);
+  EXPECT_THROW({ v.resize(4); }, std::runtime_error);
+  EXPECT_EQ(v.size(), 3u);
+  EXPECT_EQ(v.back(), 3);
+  EXPECT_THROW({ v[3]; }, std::runtime_error);
+
+  EXPECT_NO_THROW({ v.resize(1); });
+  EXPECT_EQ(v.size(), 1u);
+  EXPECT_NO_THROW({ v.resize(3, 7); });
+  EXPECT_EQ(v[2], 7);
+  int sum = 0;
+  for (const auto x : v) {
+    sum += x;
+  }
+  EXPECT_EQ(sum, 15);
+
+  EXPECT_THROW({ (c::BoundedVector<int, 2>{1, 2, 3}); }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, BoundedVector_lifetimes) {
+  auto counter = std::make_shared<int>(0);
+  {
+    c::BoundedVector<std::shared_ptr<int>, 4> v;
+    v.push_back(counter);
+    v.push_back(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+
+    auto copy = v;
+    EXPECT_EQ(counter.use_count(), 5);
+    auto moved = std::move(copy);
+    EXPECT_EQ(counter.use_count(), 5);
+    moved.clear();
+    EXPECT_EQ(counter.use_count(), 3);
+    v.pop_back();
+    EXPECT_EQ(counter.use_count(), 2);
+    moved = v;
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+
+  c::BoundedVector<std::string, 2> s{"a", "b"};
+  s.front() += "c";
+  EXPECT_EQ(s[0], "ac");
+}
+
+//------------------------------------------------------------------------------
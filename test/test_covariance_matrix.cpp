@@ -0,0 +1,111 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/covariance_matrix.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+/** @brief A A^T for a deterministic, full-rank N x N matrix A. */
+template <typename T, std::size_t N>
+std::array<T, N * N> gram_matrix() {
+  std::array<T, N * N> a;
+  for (std::size_t k = 0; k < N * N; ++k) {
+    a[k] = static_cast<T>((k * 7919) % 23) / static_cast<T>(23);
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    a[N * i + i] += static_cast<T>(N);
+  }
+  std::array<T, N * N> m{};
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t k = 0; k < N; ++k) {
+        m[N * i + j] += a[N * i + k] * a[N * j + k];
+      }
+    }
+  }
+  return m;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, CovarianceMatrix_construction) {
+  using C6 = c::CovarianceMatrix<double, 6>;
+  using C15 = c::CovarianceMatrix<float, 15>;
+  using C3 = c::CovarianceMatrix<double, 3>;
+  using C2 = c::CovarianceMatrix<double, 2>;
+  EXPECT_NO_THROW({
+    C6(gram_matrix<double, 6>());
+    C15(gram_matrix<float, 15>());
+    C6::isotropic(1.0);
+    C6::isotropic(0.0);
+  });
+
+  // Positive semidefinite, but singular: v v^T.
+  const std::array<double, 9> rank_one{{1, 2, 3, 2, 4, 6, 3, 6, 9}};
+  EXPECT_NO_THROW({ C3{rank_one}; });
+
+  // Indefinite.
+  const std::array<double, 4> indefinite{{1, 2, 2, 1}};
+  EXPECT_THROW({ C2{indefinite}; }, std::runtime_error);
+  EXPECT_THROW({ C6::isotropic(-1.0); }, std::runtime_error);
+
+  // Not symmetric.
+  const std::array<double, 4> asymmetric{{2, 1, 0, 2}};
+  EXPECT_THROW({ C2{asymmetric}; }, std::runtime_error);
+
+  // Not finite.
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  const auto inf = std::numeric_limits<double>::infinity();
+  EXPECT_THROW({ C6::isotropic(nan); }, std::runtime_error);
+  EXPECT_THROW({ C6::isotropic(inf); }, std::runtime_error);
+  const std::array<double, 4> nan_off_diagonal{{1, nan, nan, 1}};
+  EXPECT_THROW({ C2{nan_off_diagonal}; }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, CovarianceMatrix_modify) {
+  using C6 = c::CovarianceMatrix<double, 6>;
+  auto p = C6::isotropic(2.0);
+  EXPECT_NO_THROW({
+    p.modify([](std::array<double, 36>& m) {
+      m[1] = 1.0;
+      m[6] = 1.0;
+    });
+  });
+  EXPECT_EQ(p(0, 1), 1.0);
+
+  // A failed modification leaves the object unchanged.
+  EXPECT_THROW({ p.modify([](std::array<double, 36>& m) { m[1] = 5.0; }); },
+               std::runtime_error);
+  EXPECT_EQ(p(0, 1), 1.0);
+  EXPECT_TRUE(C6::is_valid(p.array()));
+
+  const auto sum = p + p;
+  EXPECT_EQ(sum(0, 0), 4.0);
+}
+
+//------------------------------------------------------------------------------
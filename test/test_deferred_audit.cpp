@@ -0,0 +1,229 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/deferred_audit.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+/** @brief Check that the values of a snapshot are sorted. */
+c::ReturnStatus is_sorted(const std::vector<int>& v) {
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    if (v[i - 1] > v[i]) {
+      return c::ReturnStatus("values are not sorted", false);
+    }
+  }
+  return c::ReturnStatus("", true);
+}
+
+/** @brief Enforce that 'v' is sorted on a worker of 'pool'. */
+void enforce_sorted(c::DeferredAuditPool& pool, const std::vector<int>& v) {
+  AUDIT_ENFORCE_DEFERRED_IN(pool, v, is_sorted);
+}
+
+/** @brief Holds the workers of a pool in checks until released. */
+class Gate {
+ public:
+  /** @brief Queue a check on 'pool' that waits for release(). */
+  void hold(c::DeferredAuditPool& pool) {
+    pool.submit(0, [this](int) {
+      ++held_;
+      while (!open_) {
+        std::this_thread::yield();
+      }
+      return true;
+    });
+  }
+
+  /** @brief Wait until 'n' checks are held. */
+  void wait_held(int n) const {
+    while (held_ < n) {
+      std::this_thread::yield();
+    }
+  }
+
+  void release() { open_ = true; }
+
+ private:
+  std::atomic<bool> open_{false};
+  std::atomic<int> held_{0};
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, pass) {
+  c::DeferredAuditPool pool(2, 16);
+  for (int i = 0; i < 100; ++i) {
+    enforce_sorted(pool, {i, i + 1, i + 2});
+  }
+  EXPECT_NO_THROW(pool.drain());
+  const auto stats = pool.stats();
+  EXPECT_EQ(stats.completed, 100u);
+  EXPECT_EQ(stats.enqueued, 100u);
+  EXPECT_EQ(stats.violations, 0u);
+  EXPECT_EQ(stats.depth, 0u);
+  EXPECT_LE(stats.max_depth, 16u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, violation_site) {
+  c::DeferredAuditPool pool;
+  enforce_sorted(pool, {2, 1});
+  try {
+    pool.drain();
+    FAIL() << "The violation must be rethrown by drain()";
+  } catch (const std::runtime_error& e) {
+    const std::string what = e.what();
+    EXPECT_NE(what.find("values are not sorted"), std::string::npos);
+    EXPECT_NE(what.find("function_name: \"enforce_sorted\""),
+              std::string::npos);
+    EXPECT_NE(what.find("test_deferred_audit.cpp"), std::string::npos);
+  }
+  EXPECT_EQ(pool.stats().violations, 1u);
+  // The exception is rethrown once.
+  EXPECT_NO_THROW(pool.drain());
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, snapshot_by_value) {
+  c::DeferredAuditPool pool;
+  Gate gate;
+  gate.hold(pool);
+  gate.wait_held(1);
+
+  std::vector<int> v{1, 2, 3};
+  enforce_sorted(pool, v);
+  // The check is evaluated after the caller changed its inputs.
+  v = {3, 2, 1};
+  gate.release();
+  EXPECT_NO_THROW(pool.drain());
+  EXPECT_EQ(pool.stats().violations, 0u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, user_copy) {
+  c::DeferredAuditPool pool;
+  auto values = std::make_shared<std::vector<int>>(std::vector<int>{1, 2});
+  // The snapshot is a copy made by the caller, here a move-only one.
+  AUDIT_ENFORCE_DEFERRED_IN(
+      pool, std::unique_ptr<std::vector<int>>(new std::vector<int>(*values)),
+      [](const std::unique_ptr<std::vector<int>>& v) {
+        return is_sorted(*v);
+      });
+  values->assign({2, 1});
+  EXPECT_NO_THROW(pool.drain());
+  EXPECT_EQ(pool.stats().completed, 1u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, backpressure_drop) {
+  c::DeferredAuditPool pool(1, 2, c::Backpressure::drop);
+  Gate gate;
+  gate.hold(pool);
+  gate.wait_held(1);
+  for (int i = 0; i < 5; ++i) {
+    enforce_sorted(pool, {2, 1});
+  }
+  EXPECT_EQ(pool.stats().depth, 2u);
+  gate.release();
+  EXPECT_THROW(pool.drain(), std::runtime_error);
+
+  const auto stats = pool.stats();
+  EXPECT_EQ(stats.dropped, 3u);
+  EXPECT_EQ(stats.enqueued, 3u);
+  EXPECT_EQ(stats.completed, 3u);
+  EXPECT_EQ(stats.violations, 2u);
+  EXPECT_EQ(stats.max_depth, 2u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, backpressure_run_inline) {
+  c::DeferredAuditPool pool(1, 1, c::Backpressure::run_inline);
+  Gate gate;
+  gate.hold(pool);
+  gate.wait_held(1);
+  enforce_sorted(pool, {1, 2});
+
+  // With the queue full, the check runs, and reports, on the caller.
+  const auto caller = std::this_thread::get_id();
+  std::thread::id checker;
+  pool.submit(0, [&checker](int) {
+    checker = std::this_thread::get_id();
+    return true;
+  });
+  EXPECT_EQ(checker, caller);
+  EXPECT_THROW(enforce_sorted(pool, {2, 1}), std::runtime_error);
+
+  gate.release();
+  EXPECT_NO_THROW(pool.drain());
+  const auto stats = pool.stats();
+  EXPECT_EQ(stats.run_inline, 2u);
+  EXPECT_EQ(stats.completed, 4u);
+  EXPECT_EQ(stats.dropped, 0u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, backpressure_block) {
+  c::DeferredAuditPool pool(1, 1, c::Backpressure::block);
+  Gate gate;
+  gate.hold(pool);
+  gate.wait_held(1);
+  enforce_sorted(pool, {1, 2});
+
+  std::atomic<bool> submitted{false};
+  std::thread producer([&]() {
+    enforce_sorted(pool, {1, 2});
+    submitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(submitted);
+  gate.release();
+  producer.join();
+  EXPECT_TRUE(submitted);
+
+  EXPECT_NO_THROW(pool.drain());
+  const auto stats = pool.stats();
+  EXPECT_EQ(stats.completed, 3u);
+  EXPECT_EQ(stats.enqueued, 3u);
+  EXPECT_EQ(stats.max_depth, 1u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_DeferredAudit, no_workers) {
+  c::DeferredAuditPool pool(0);
+  EXPECT_THROW(enforce_sorted(pool, {2, 1}), std::runtime_error);
+  EXPECT_EQ(pool.stats().run_inline, 1u);
+}
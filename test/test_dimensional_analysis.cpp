@@ -14,6 +14,7 @@
 
 #define _USE_MATH_DEFINES
 #include <cmath>
+#include <limits>
 
 #include "contracts_lite/simple_violation_handler.hpp"
 #include "contracts_lite/types/acute_degree.hpp"
@@ -46,3 +47,49 @@ TEST(Contracts_DimensionalAnalysis, AcuteRadian_float) {
 }
 
 //------------------------------------------------------------------------------
+
+TEST(Contracts_DimensionalAnalysis, AcuteDegree_float_upper_bound) {
+  const auto max_deg = std::nextafter(90.0f, 0.0f);
+  ASSERT_EQ(c::AcuteDegree<float>::max_value(), max_deg);
+
+  // Rounding during conversion must never produce pi/2 (checked in AUDIT).
+  c::AcuteDegree<float> d{max_deg};
+  EXPECT_NO_THROW({ c::AcuteRadian<float>{d}; });
+  EXPECT_LT(c::AcuteRadian<float>{d}, static_cast<float>(M_PI * 0.5));
+  EXPECT_NO_THROW({
+    c::AcuteRadian<float> r{0.0f};
+    r = d;
+  });
+  EXPECT_NO_THROW({ c::AcuteRadian<double>{c::AcuteDegree<double>{89.9}}; });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contracts_DimensionalAnalysis, AcuteRadian_float_upper_bound) {
+  const auto max_rad = std::nextafter(static_cast<float>(M_PI * 0.5), 0.0f);
+  ASSERT_EQ(c::AcuteRadian<float>::max_value(), max_rad);
+
+  // Rounding during conversion must never produce 90 (checked in AUDIT).
+  c::AcuteRadian<float> r{max_rad};
+  EXPECT_NO_THROW({ c::AcuteDegree<float>{r}; });
+  EXPECT_LT(c::AcuteDegree<float>{r}, 90.0f);
+  EXPECT_NO_THROW({
+    c::AcuteDegree<float> d{0.0f};
+    d = r;
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contracts_DimensionalAnalysis, assume_valid) {
+  EXPECT_NO_THROW({ c::AcuteRadian<float>(0.5f, c::assume_valid); });
+  EXPECT_NO_THROW({ c::AcuteDegree<float>(45.0f, c::assume_valid); });
+
+  // Invalid input to the trusted constructors is still caught in AUDIT builds.
+  EXPECT_THROW({ c::AcuteRadian<float>(2.0f, c::assume_valid); },
+               std::runtime_error);
+  EXPECT_THROW({ c::AcuteDegree<float>(90.0f, c::assume_valid); },
+               std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,170 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "contracts_lite/float16.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+using c::bfloat16;
+using c::float16;
+
+static_assert(sizeof(c::UnitReal<float16>) == 2, "No overhead over the bits");
+static_assert(c::UnitReal<float16>::is_valid(float16(0.5)),
+              "Predicate must be constexpr");
+static_assert(!c::UnitReal<bfloat16>::is_valid(bfloat16(2.0)),
+              "Predicate must be constexpr");
+
+namespace {
+
+/** @brief Float nearest to 'x' with 'digits' significant bits, ties to even. */
+float round_to_digits(double x, int digits) {
+  int e = 0;
+  const double m = std::frexp(x, &e);
+  return static_cast<float>(
+      std::ldexp(std::nearbyint(std::ldexp(m, digits)), e - digits));
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Float16, float16_round_trip) {
+  // Every binary16 converts exactly to float and back, and the conversion
+  // usable in constant expressions agrees with the conversion from float.
+  for (std::uint32_t b = 0; b <= 0xffffu; ++b) {
+    const auto h = float16::from_bits(static_cast<std::uint16_t>(b));
+    const float f = h;
+    if (std::isnan(f)) {
+      EXPECT_TRUE(std::isnan(static_cast<float>(float16(f))));
+      continue;
+    }
+    EXPECT_EQ(float16(f).bits(), b) << f;
+    // The constant conversion does not keep the sign of zero.
+    EXPECT_EQ(float16(static_cast<double>(f)).bits(), (b == 0x8000u) ? 0u : b)
+        << f;
+  }
+}
+
+TEST(Contract_Float16, bfloat16_round_trip) {
+  for (std::uint32_t b = 0; b <= 0xffffu; ++b) {
+    const auto h = bfloat16::from_bits(static_cast<std::uint16_t>(b));
+    const float f = h;
+    if (std::isnan(f)) {
+      EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(f))));
+      continue;
+    }
+    EXPECT_EQ(bfloat16(f).bits(), b) << f;
+    EXPECT_EQ(bfloat16(static_cast<double>(f)).bits(), (b == 0x8000u) ? 0u : b)
+        << f;
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Float16, rounding) {
+  // Normal range, subnormal range and overflow, against frexp and ldexp.
+  const std::vector<double> values{1.0 / 3.0, 1.0 + 1.0 / 2048.0, 2049.0,
+                                   3.0e-5,    7.0e-8,             65519.0,
+                                   1.1e-38,   1.0e38,             -0.1};
+  for (const double v : values) {
+    const float f = static_cast<float>(v);
+    const float half =
+        (std::fabs(v) >= 65520.0)
+            ? std::numeric_limits<float>::infinity()
+            : (std::fabs(v) < std::ldexp(1.0, -14))
+                  ? static_cast<float>(
+                        std::ldexp(std::nearbyint(std::ldexp(v, 24)), -24))
+                  : round_to_digits(v, 11);
+    EXPECT_EQ(static_cast<float>(float16(v)), half) << v;
+    if (f == v || std::fabs(v) < 65504.0) {
+      EXPECT_EQ(static_cast<float>(float16(f)), half) << v;
+    }
+    EXPECT_EQ(static_cast<float>(bfloat16(v)), round_to_digits(v, 8)) << v;
+  }
+
+  // Ties round to even.
+  EXPECT_EQ(float16(1.0f + 1.0f / 2048.0f).bits(), float16(1.0f).bits());
+  EXPECT_EQ(float16(1.0f + 3.0f / 2048.0f).bits(),
+            float16(1.0f + 4.0f / 2048.0f).bits());
+  EXPECT_EQ(bfloat16(1.0f + 1.0f / 256.0f).bits(), bfloat16(1.0f).bits());
+
+  const auto inf = std::numeric_limits<float>::infinity();
+  EXPECT_EQ(static_cast<float>(float16(65520.0f)), inf);
+  EXPECT_EQ(static_cast<float>(float16(-inf)), -inf);
+  EXPECT_EQ(static_cast<float>(std::numeric_limits<float16>::max()), 65504.0f);
+  EXPECT_EQ(static_cast<float>(std::numeric_limits<float16>::denorm_min()),
+            std::ldexp(1.0f, -24));
+  EXPECT_EQ(static_cast<float>(std::numeric_limits<float16>::epsilon()),
+            std::ldexp(1.0f, -10));
+  EXPECT_EQ(static_cast<float>(std::numeric_limits<bfloat16>::max()),
+            std::ldexp(255.0f, 120));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Float16, bounded_reals) {
+  const float16 nan = std::numeric_limits<float16>::quiet_NaN();
+  const float16 inf = std::numeric_limits<float16>::infinity();
+  EXPECT_THROW({ c::Real<float16>{nan}; }, std::runtime_error);
+  EXPECT_THROW({ c::Real<float16>{inf}; }, std::runtime_error);
+  EXPECT_THROW({ c::UnitReal<float16>{float16(1.5f)}; }, std::runtime_error);
+  EXPECT_THROW({ c::NonnegativeReal<bfloat16>{bfloat16(-1.0f)}; },
+               std::runtime_error);
+  EXPECT_NO_THROW({
+    c::Real<float16>{float16(-65504.0f)};
+    c::UnitReal<float16>{float16(1.0f)};
+    c::UnitReal<bfloat16>{bfloat16(0.0f)};
+    c::NonnegativeReal<float16>{float16(-0.0f)};
+    c::StrictlyPositiveReal<float16>{
+        std::numeric_limits<float16>::denorm_min()};
+  });
+
+  // Conversions are checked in both directions.
+  using UnitHalf = c::UnitReal<float16>;
+  const UnitHalf u(float16(0.25f));
+  EXPECT_EQ(static_cast<float>(c::real_cast<float>(u)), 0.25f);
+  const c::NonnegativeReal<float> large(70000.0f);
+  const c::StrictlyPositiveReal<float> small(1.0e-10f);
+  EXPECT_THROW({ c::real_cast<float16>(large); }, std::runtime_error);
+  EXPECT_THROW({ c::real_cast<float16>(small); }, std::runtime_error);
+  EXPECT_NO_THROW({ c::real_cast<bfloat16>(large); });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Float16, check_batch) {
+  std::vector<float16> buffer;
+  for (int i = 0; i <= 100; ++i) {
+    buffer.emplace_back(static_cast<float>(i) / 100.0f);
+  }
+  EXPECT_TRUE(c::UnitReal<float16>::check_batch(buffer.data(), buffer.size()));
+  buffer[37] = std::numeric_limits<float16>::quiet_NaN();
+  EXPECT_FALSE(
+      c::UnitReal<float16>::check_batch(buffer.data(), buffer.size()));
+  buffer[37] = float16(-0.0f);
+  EXPECT_TRUE(c::UnitReal<float16>::check_batch(buffer.data(), buffer.size()));
+  buffer[99] = float16(1.001f);
+  EXPECT_FALSE(
+      c::UnitReal<float16>::check_batch(buffer.data(), buffer.size()));
+}
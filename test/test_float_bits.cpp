@@ -0,0 +1,130 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "contracts_lite/float_bits.hpp"
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/nonzero_real.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+namespace fb = contracts_lite::float_bits;
+
+namespace {
+
+/**
+ * @brief NaN and infinities computed at run time, so that the compiler cannot
+ * see them even when it assumes they never occur.
+ */
+template <typename T>
+struct NonFinite {
+  volatile T zero = 0;
+  volatile T one = 1;
+  T nan() const { return zero / zero; }
+  T inf() const { return one / zero; }
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+template <typename T>
+class Contract_FloatBits : public ::testing::Test {};
+using FloatTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(Contract_FloatBits, FloatTypes);
+
+TYPED_TEST(Contract_FloatBits, predicates) {
+  using T = TypeParam;
+  const NonFinite<T> v;
+  const T max = std::numeric_limits<T>::max();
+  const T denorm = std::numeric_limits<T>::denorm_min();
+
+  EXPECT_TRUE(fb::is_finite(static_cast<T>(0)));
+  EXPECT_TRUE(fb::is_finite(-max));
+  EXPECT_TRUE(fb::is_finite(denorm));
+  EXPECT_FALSE(fb::is_finite(v.inf()));
+  EXPECT_FALSE(fb::is_finite(-v.inf()));
+  EXPECT_FALSE(fb::is_finite(v.nan()));
+
+  // With fast-math, std::isnan would be folded to false here.
+  EXPECT_TRUE(fb::is_nan(v.nan()));
+  EXPECT_TRUE(fb::is_nan(-v.nan()));
+  EXPECT_FALSE(fb::is_nan(v.inf()));
+  EXPECT_FALSE(fb::is_nan(max));
+
+  EXPECT_TRUE(fb::is_inf(v.inf()));
+  EXPECT_TRUE(fb::is_inf(-v.inf()));
+  EXPECT_FALSE(fb::is_inf(v.nan()));
+  EXPECT_FALSE(fb::is_inf(max));
+
+  EXPECT_TRUE(fb::sign_bit(static_cast<T>(-0.0)));
+  EXPECT_TRUE(fb::sign_bit(-denorm));
+  EXPECT_FALSE(fb::sign_bit(static_cast<T>(0)));
+  EXPECT_FALSE(fb::sign_bit(v.inf()));
+}
+
+TYPED_TEST(Contract_FloatBits, ordered_key) {
+  using T = TypeParam;
+  const NonFinite<T> v;
+  const T max = std::numeric_limits<T>::max();
+  const T denorm = std::numeric_limits<T>::denorm_min();
+  const std::vector<T> increasing{-v.inf(), -max, static_cast<T>(-1), -denorm,
+                                  static_cast<T>(0), denorm, static_cast<T>(1),
+                                  max, v.inf()};
+  for (std::size_t i = 1; i < increasing.size(); ++i) {
+    EXPECT_LT(fb::ordered_key(increasing[i - 1]),
+              fb::ordered_key(increasing[i]))
+        << increasing[i - 1] << " < " << increasing[i];
+  }
+  EXPECT_EQ(fb::ordered_key(static_cast<T>(0)),
+            fb::ordered_key(static_cast<T>(-0.0)));
+  // 0 / 0 may be a NaN of either sign, e.g., negative on x86.
+  const T nan = std::fabs(v.nan());
+  EXPECT_GT(fb::ordered_key(nan), fb::ordered_key(v.inf()));
+  EXPECT_LT(fb::ordered_key(-nan), fb::ordered_key(-v.inf()));
+}
+
+//------------------------------------------------------------------------------
+
+/**
+ * This test is also built with -ffast-math, where comparisons of floats could
+ * be folded under the assumption that NaN and infinities never occur.
+ */
+TYPED_TEST(Contract_FloatBits, violations_are_detected) {
+  using T = TypeParam;
+  const NonFinite<T> v;
+  EXPECT_THROW({ c::Real<T>{v.nan()}; }, std::runtime_error);
+  EXPECT_THROW({ c::Real<T>{v.inf()}; }, std::runtime_error);
+  EXPECT_THROW({ c::Real<T>{-v.inf()}; }, std::runtime_error);
+  EXPECT_THROW({ c::NonnegativeReal<T>{v.nan()}; }, std::runtime_error);
+  EXPECT_THROW({ c::NonnegativeReal<T>{v.inf()}; }, std::runtime_error);
+  EXPECT_THROW({ c::StrictlyPositiveReal<T>{v.nan()}; }, std::runtime_error);
+  EXPECT_THROW({ c::StrictlyPositiveReal<T>{-v.nan()}; }, std::runtime_error);
+  EXPECT_THROW({ c::NonzeroReal<T>{v.nan()}; }, std::runtime_error);
+  EXPECT_THROW({ c::NonzeroReal<T>{-v.inf()}; }, std::runtime_error);
+  EXPECT_FALSE(c::Real<T>::is_valid(v.nan()));
+  EXPECT_FALSE(c::Real<T>::is_valid(v.inf()));
+  EXPECT_FALSE(c::NonnegativeReal<T>::is_valid(-v.nan()));
+
+  EXPECT_NO_THROW({ c::Real<T>{std::numeric_limits<T>::max()}; });
+  EXPECT_NO_THROW({ c::NonnegativeReal<T>{static_cast<T>(-0.0)}; });
+  EXPECT_TRUE(c::StrictlyPositiveReal<T>::is_valid(
+      std::numeric_limits<T>::denorm_min()));
+}
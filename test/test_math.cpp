@@ -0,0 +1,84 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/math.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Math, sqrt) {
+  using N = c::NonnegativeReal<float>;
+  using P = c::StrictlyPositiveReal<double>;
+  using U = c::UnitReal<float>;
+  static_assert(std::is_same<decltype(c::sqrt(N(4.0f))), N>::value, "");
+  static_assert(std::is_same<decltype(c::sqrt(P(4.0))), P>::value, "");
+  static_assert(std::is_same<decltype(c::sqrt(U(0.25f))), U>::value, "");
+
+  EXPECT_EQ(static_cast<float>(c::sqrt(N(4.0f))), 2.0f);
+  EXPECT_EQ(static_cast<float>(c::sqrt(N(0.0f))), 0.0f);
+  EXPECT_TRUE(std::signbit(static_cast<float>(c::sqrt(N(-0.0f)))));
+  EXPECT_EQ(static_cast<double>(c::sqrt(P(2.0))), std::sqrt(2.0));
+  EXPECT_EQ(static_cast<float>(c::sqrt(U(0.25f))), 0.5f);
+
+  // Same results as libm at the ends of the ranges.
+  const auto max = std::numeric_limits<float>::max();
+  const auto min = std::numeric_limits<double>::denorm_min();
+  EXPECT_EQ(static_cast<float>(c::sqrt(N(max))), std::sqrt(max));
+  EXPECT_EQ(static_cast<double>(c::sqrt(P(min))), std::sqrt(min));
+  EXPECT_GT(static_cast<double>(c::sqrt(P(min))), 0.0);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Math, log) {
+  using P = c::StrictlyPositiveReal<double>;
+  static_assert(
+      std::is_same<decltype(c::log(P(1.0))), c::Real<double>>::value, "");
+
+  EXPECT_EQ(static_cast<double>(c::log(P(1.0))), 0.0);
+  EXPECT_EQ(static_cast<double>(c::log(P(M_E))), std::log(M_E));
+  const auto min = std::numeric_limits<double>::denorm_min();
+  EXPECT_EQ(static_cast<double>(c::log(P(min))), std::log(min));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Math, reciprocal) {
+  EXPECT_EQ(c::reciprocal(c::NonzeroReal<float>(4.0f)), 0.25f);
+  EXPECT_EQ(c::reciprocal(c::NonzeroReal<double>(-2.0)), -0.5);
+  const auto denorm = std::numeric_limits<float>::denorm_min();
+  EXPECT_TRUE(std::isinf(c::reciprocal(c::NonzeroReal<float>(denorm))));
+  EXPECT_GT(c::reciprocal(
+                c::NonzeroReal<float>(std::numeric_limits<float>::max())),
+            0.0f);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Math, argument_dependent_lookup) {
+  // Unqualified calls pick the overloads for contract types over std.
+  using std::sqrt;
+  const c::NonnegativeReal<float> x(9.0f);
+  static_assert(
+      std::is_same<decltype(sqrt(x)), c::NonnegativeReal<float>>::value, "");
+  EXPECT_EQ(static_cast<float>(sqrt(x)), 3.0f);
+  EXPECT_EQ(sqrt(9.0f), 3.0f);
+}
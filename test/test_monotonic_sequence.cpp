@@ -0,0 +1,101 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/monotonic_sequence.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+static constexpr auto NaN = std::numeric_limits<double>::quiet_NaN();
+
+//------------------------------------------------------------------------------
+
+template <typename Sequence>
+void test_push_back(Sequence& s) {
+  EXPECT_TRUE(s.empty());
+  EXPECT_NO_THROW({
+    s.push_back(1.0);
+    s.push_back(2.0);
+    s.push_back(3.0);
+  });
+  EXPECT_THROW({ s.push_back(3.0); }, std::runtime_error);
+  EXPECT_THROW({ s.push_back(-1.0); }, std::runtime_error);
+  EXPECT_THROW({ s.push_back(NaN); }, std::runtime_error);
+  EXPECT_EQ(s.size(), 3u);
+
+  // Once full, the oldest elements are replaced.
+  EXPECT_NO_THROW({
+    s.push_back(4.0);
+    s.push_back(5.0);
+  });
+  EXPECT_TRUE(s.full());
+  EXPECT_EQ(s.size(), 4u);
+  EXPECT_EQ(s.front(), 2.0);
+  EXPECT_EQ(s.back(), 5.0);
+  EXPECT_EQ(s[1], 3.0);
+  EXPECT_THROW({ s[4]; }, std::runtime_error);
+  EXPECT_TRUE(s.check());
+
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_THROW({ s.back(); }, std::runtime_error);
+  EXPECT_NO_THROW({ s.push_back(-10.0); });
+}
+
+TEST(Contract_Types, MonotonicSequence_push_back) {
+  c::MonotonicSequence<double, 4> fixed;
+  EXPECT_EQ(fixed.capacity(), 4u);
+  test_push_back(fixed);
+
+  c::MonotonicSequence<double> dynamic(4);
+  EXPECT_EQ(dynamic.capacity(), 4u);
+  test_push_back(dynamic);
+
+  EXPECT_THROW({ c::MonotonicSequence<double>{0}; }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, MonotonicSequence_append) {
+  c::MonotonicSequence<int64_t> s(8);
+  const std::vector<int64_t> a{1, 2, 3, 5, 8};
+  EXPECT_NO_THROW({ s.append(a.data(), a.size()); });
+  EXPECT_EQ(s.size(), 5u);
+  EXPECT_EQ(s.back(), 8);
+
+  // The range must be increasing and follow the last element.
+  const std::vector<int64_t> unsorted{10, 12, 11};
+  EXPECT_THROW({ s.append(unsorted.data(), unsorted.size()); },
+               std::runtime_error);
+  EXPECT_THROW({ s.append(a.data(), a.size()); }, std::runtime_error);
+  EXPECT_EQ(s.size(), 5u);
+
+  // Appending more than the capacity keeps the last elements.
+  std::vector<int64_t> many;
+  for (int64_t i = 100; i < 120; ++i) {
+    many.push_back(i);
+  }
+  EXPECT_NO_THROW({ s.append(many.data(), many.size()); });
+  EXPECT_EQ(s.size(), 8u);
+  EXPECT_EQ(s.front(), 112);
+  EXPECT_EQ(s.back(), 119);
+  EXPECT_NO_THROW({ s.append(many.data(), 0); });
+  EXPECT_TRUE(s.check());
+}
+
+//------------------------------------------------------------------------------
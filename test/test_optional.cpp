@@ -0,0 +1,95 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/optional.hpp"
+#include "contracts_lite/types/acute_degree.hpp"
+#include "contracts_lite/types/acute_radian.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/nonzero_real.hpp"
+#include "contracts_lite/types/real.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/strictly_positive_odd_integer.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+static_assert(sizeof(c::optional<c::NonnegativeReal<float>>) == sizeof(float),
+              "Empty state must be stored in the niche");
+static_assert(sizeof(c::optional<c::Real<double>>) == sizeof(double),
+              "Empty state must be stored in the niche");
+static_assert(sizeof(c::optional<c::UnitReal<float>>) == sizeof(float),
+              "Empty state must be stored in the niche");
+static_assert(sizeof(c::optional<c::AcuteDegree<float>>) == sizeof(float),
+              "Empty state must be stored in the niche");
+static_assert(sizeof(c::optional<c::AcuteRadian<float>>) == sizeof(float),
+              "Empty state must be stored in the niche");
+static_assert(sizeof(c::optional<c::NonzeroReal<float>>) == sizeof(float),
+              "Empty state must be stored in the niche");
+static_assert(sizeof(c::optional<c::SizeBound<254>>) == 1,
+              "Empty state must be stored in the niche");
+static_assert(sizeof(c::optional<c::StrictlyPositiveOddInteger<int>>) ==
+                  sizeof(int),
+              "Empty state must be stored in the niche");
+
+// Without a niche, a separate flag is needed.
+static_assert(!c::niche_traits<c::SizeBound<255>>::has_niche,
+              "SizeBound<255> has no spare value in one byte");
+static_assert(sizeof(c::optional<c::SizeBound<255>>) == 2,
+              "Empty state must be stored in a flag");
+
+//------------------------------------------------------------------------------
+
+template <typename X>
+void test_optional(X valid) {
+  c::optional<X> o;
+  EXPECT_FALSE(o.has_value());
+  EXPECT_FALSE(o);
+  EXPECT_THROW({ o.value(); }, std::runtime_error);
+  EXPECT_THROW({ *o; }, std::runtime_error);
+  EXPECT_EQ(o.value_or(valid), valid);
+
+  o = valid;
+  EXPECT_TRUE(o.has_value());
+  EXPECT_TRUE(o);
+  EXPECT_EQ(o.value(), valid);
+  EXPECT_EQ(*o, valid);
+
+  o = c::nullopt;
+  EXPECT_FALSE(o.has_value());
+
+  const c::optional<X> copy{valid};
+  o = copy;
+  EXPECT_EQ(o.value(), valid);
+  o.reset();
+  EXPECT_FALSE(o.has_value());
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, optional) {
+  test_optional(c::NonnegativeReal<float>{1.5f});
+  test_optional(c::Real<double>{-2.0});
+  test_optional(c::UnitReal<float>{0.0f});
+  test_optional(c::AcuteDegree<float>{45.0f});
+  test_optional(c::AcuteRadian<double>{0.5});
+  test_optional(c::NonzeroReal<float>{-1.0f});
+  test_optional(c::SizeBound<254>{254});
+  test_optional(c::SizeBound<255>{255});
+  test_optional(c::SizeBound<10>{0});
+  test_optional(c::StrictlyPositiveOddInteger<int>{3});
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,124 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <limits>
+#include <ratio>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/probability_simplex.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+static constexpr auto NaNf = std::numeric_limits<float>::quiet_NaN();
+static constexpr auto INFf = std::numeric_limits<float>::infinity();
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, ProbabilitySimplex_float) {
+  using P = c::ProbabilitySimplex<float, 3>;
+  EXPECT_THROW({ P(std::array<float, 3>{{0.5f, 0.5f, 0.5f}}); },
+               std::runtime_error);
+  EXPECT_THROW({ P(std::array<float, 3>{{1.5f, -0.5f, 0.0f}}); },
+               std::runtime_error);
+  EXPECT_THROW({ P(std::array<float, 3>{{NaNf, 0.5f, 0.5f}}); },
+               std::runtime_error);
+  EXPECT_THROW({ P(std::array<float, 3>{{INFf, 0.0f, 0.0f}}); },
+               std::runtime_error);
+  EXPECT_THROW(
+      { P(std::array<float, 3>{{0.1f, 0.1f, 0.1f}}, c::assume_valid); },
+      std::runtime_error);
+  EXPECT_NO_THROW({
+    P(std::array<float, 3>{{1.0f, 0.0f, 0.0f}});
+    P(std::array<float, 3>{{0.2f, 0.3f, 0.5f}});
+    const P p(std::array<float, 3>{{0.1f, 0.2f, 0.7f}});
+    EXPECT_EQ(p.size(), 3u);
+    EXPECT_FLOAT_EQ(p[2], 0.7f);
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, ProbabilitySimplex_tolerance) {
+  const std::array<double, 2> p{{0.5, 0.5 + 1e-6}};
+  using Loose = c::simplex_tolerance::Absolute<std::ratio<1, 100000>>;
+  using Strict = c::DefaultSimplexTolerance;
+  using LooseP = c::ProbabilitySimplex<double, 2, Loose>;
+  using StrictP = c::ProbabilitySimplex<double, 2, Strict>;
+  EXPECT_NO_THROW({ LooseP{p}; });
+  EXPECT_THROW({ StrictP{p}; }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, ProbabilitySimplex_compensated_sum) {
+  // Plain float summation of 1 / n drifts well outside of the tolerance.
+  const std::size_t n = 1000003;
+  std::vector<float> p(n, 1.0f / static_cast<float>(n));
+  float naive = 0.0f;
+  for (const auto x : p) {
+    naive += x;
+  }
+  EXPECT_GT(std::abs(naive - 1.0f), 64 * std::numeric_limits<float>::epsilon());
+  EXPECT_NO_THROW({ c::ProbabilitySimplexView<float>(p.data(), p.size()); });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, ProbabilitySimplex_normalize_and_validate) {
+  using P = c::ProbabilitySimplex<float, 4>;
+  const auto p = P::normalize_and_validate({{1.0f, 2.0f, 3.0f, 4.0f}});
+  EXPECT_FLOAT_EQ(p[0], 0.1f);
+  EXPECT_FLOAT_EQ(p[3], 0.4f);
+
+  // The reciprocal of a subnormal sum overflows, but the quotients do not.
+  const auto tiny = P::normalize_and_validate(
+      {{std::numeric_limits<float>::denorm_min(), 0.0f, 0.0f, 0.0f}});
+  EXPECT_EQ(tiny[0], 1.0f);
+  EXPECT_EQ(tiny[1], 0.0f);
+  EXPECT_THROW({ P::normalize_and_validate({{0.0f, 0.0f, 0.0f, 0.0f}}); },
+               std::runtime_error);
+  EXPECT_THROW({ P::normalize_and_validate({{-1.0f, 2.0f, 0.0f, 0.0f}}); },
+               std::runtime_error);
+  EXPECT_THROW({ P::normalize_and_validate({{INFf, 2.0f, 0.0f, 0.0f}}); },
+               std::runtime_error);
+  EXPECT_THROW({ P::normalize_and_validate({{NaNf, 2.0f, 0.0f, 0.0f}}); },
+               std::runtime_error);
+
+  std::vector<double> w(17, 3.0);
+  const auto view = c::ProbabilitySimplexView<double>::normalize_and_validate(
+      w.data(), w.size());
+  EXPECT_EQ(view.size(), 17u);
+  EXPECT_DOUBLE_EQ(view[16], 1.0 / 17.0);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, ProbabilitySimplexView) {
+  const std::vector<double> p{0.25, 0.25, 0.5};
+  EXPECT_NO_THROW({ c::ProbabilitySimplexView<double>(p.data(), p.size()); });
+  EXPECT_THROW({ c::ProbabilitySimplexView<double>(p.data(), 2); },
+               std::runtime_error);
+  EXPECT_THROW({ c::ProbabilitySimplexView<double>(p.data(), 0); },
+               std::runtime_error);
+
+  const c::ProbabilitySimplex<double, 3> fixed(
+      std::array<double, 3>{{0.25, 0.25, 0.5}});
+  const c::ProbabilitySimplexView<double> view = fixed;
+  EXPECT_EQ(view.size(), 3u);
+  EXPECT_EQ(view.begin(), fixed.begin());
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,52 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Built with CONTRACT_PROBES_ON (see CMakeLists.txt): the probes must not
+// change the behavior of the checks. The check_probes test checks that the
+// probes of this binary are in its ELF notes.
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/audit_cache.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Probes, checks) {
+  EXPECT_NO_THROW({ c::UnitReal<float>{0.5f}; });
+  EXPECT_THROW({ c::UnitReal<float>{2.0f}; }, std::runtime_error);
+  EXPECT_NO_THROW({ DEFAULT_ENFORCE(c::ReturnStatus("pass", true)); });
+  EXPECT_THROW({ AUDIT_ENFORCE(c::ReturnStatus("fail", false)); },
+               std::runtime_error);
+
+  c::AuditCache<16> cache;
+  const int object = 0;
+  EXPECT_NO_THROW({
+    AUDIT_ENFORCE_CACHED_IN(cache, object, 1, c::ReturnStatus("", true));
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Probes, site) {
+  const std::string site = CONTRACT_PROBE_SITE;
+  const std::string line = ":" + std::to_string(__LINE__ - 1);
+  EXPECT_EQ(site, std::string(__FILE__) + line);
+}
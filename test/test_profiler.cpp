@@ -0,0 +1,190 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Built with CONTRACT_PROFILING_ON (see CMakeLists.txt).
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/profiler.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+namespace p = contracts_lite::profiler;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+/** @brief Enforces a cheap check at a single site. */
+void profiled_cheap(int x) {
+  DEFAULT_ENFORCE(c::ReturnStatus("x must be nonnegative", x >= 0));
+}
+
+/** @brief Enforces a check costing about 'n' dependent operations. */
+void profiled_expensive(int n) {
+  DEFAULT_ENFORCE(([n]() {
+    volatile std::uint64_t h = 0;
+    for (int i = 0; i < n; ++i) {
+      h = h * 31 + static_cast<std::uint64_t>(i);
+    }
+    return c::ReturnStatus("", h != 1);
+  }()));
+}
+
+/** @brief Enforces a check from other threads only. */
+void profiled_in_thread() {
+  DEFAULT_ENFORCE(c::ReturnStatus("", true));
+}
+
+/** @brief Statistics of the site in 'function', or nullptr. */
+const p::SiteStats* find(const std::vector<p::SiteStats>& sites,
+                         const char* function) {
+  for (const auto& s : sites) {
+    if (std::strcmp(s.function, function) == 0) {
+      return &s;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Profiler, histogram) {
+  EXPECT_EQ(p::Histogram::bucket(0), 0u);
+  EXPECT_EQ(p::Histogram::bucket(1), 1u);
+  EXPECT_EQ(p::Histogram::bucket(7), 3u);
+  EXPECT_EQ(p::Histogram::bucket(8), 4u);
+  EXPECT_EQ(p::Histogram::bucket(UINT64_MAX), 64u);
+  EXPECT_EQ(p::Histogram::upper_bound(4), 15u);
+  EXPECT_EQ(p::Histogram::upper_bound(64), UINT64_MAX);
+
+  p::Histogram h;
+  for (int i = 0; i < 99; ++i) {
+    h.add(5);
+  }
+  h.add(1000);
+  EXPECT_EQ(h.count(), 100u);
+  EXPECT_EQ(h.total(), 99u * 5u + 1000u);
+  EXPECT_EQ(h.quantile_bound(0.5), 7u);
+  EXPECT_EQ(h.quantile_bound(1.0), 1023u);
+
+  p::Histogram g;
+  g.add(0);
+  g.merge(h);
+  EXPECT_EQ(g.count(), 101u);
+  EXPECT_EQ(g.bucket_count(0), 1u);
+  EXPECT_EQ(g.bucket_count(3), 99u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Profiler, sites) {
+  for (int i = 0; i < 1000; ++i) {
+    profiled_cheap(i);
+  }
+  EXPECT_THROW(profiled_cheap(-1), std::runtime_error);
+  p::flush();
+
+  const auto sites = p::registry().ranked();
+  const auto* site = find(sites, "profiled_cheap");
+  ASSERT_NE(site, nullptr);
+  EXPECT_EQ(site->histogram.count(), 1001u);
+  EXPECT_STREQ(site->file, __FILE__);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Profiler, ranked_by_total_time) {
+  for (int i = 0; i < 100; ++i) {
+    profiled_cheap(i);
+    profiled_expensive(10000);
+  }
+  p::flush();
+
+  const auto sites = p::registry().ranked();
+  ASSERT_GE(sites.size(), 2u);
+  EXPECT_STREQ(sites[0].function, "profiled_expensive");
+  for (std::size_t i = 1; i < sites.size(); ++i) {
+    EXPECT_GE(sites[i - 1].histogram.total(), sites[i].histogram.total());
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Profiler, threads) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([]() {
+      for (int i = 0; i < 100; ++i) {
+        profiled_in_thread();
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // The histograms of the threads were merged when they exited.
+  const auto* site = find(p::registry().ranked(), "profiled_in_thread");
+  ASSERT_NE(site, nullptr);
+  EXPECT_EQ(site->histogram.count(), 400u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Profiler, overhead_subtracted) {
+#ifdef CONTRACT_PROFILER_TSC
+  EXPECT_GT(p::registry().overhead(), 0u);
+#endif
+  // An empty check costs about as much as the calibrated empty region, so
+  // its median time, less the overhead, is within the timing noise.
+  for (int i = 0; i < 1000; ++i) {
+    profiled_in_thread();
+  }
+  p::flush();
+  const auto* site = find(p::registry().ranked(), "profiled_in_thread");
+  ASSERT_NE(site, nullptr);
+  const auto overhead = p::registry().overhead();
+  EXPECT_LE(site->histogram.quantile_bound(0.5),
+            p::Histogram::upper_bound(p::Histogram::bucket(overhead)));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Profiler, report) {
+  profiled_cheap(1);
+  std::FILE* out = std::tmpfile();
+  ASSERT_NE(out, nullptr);
+  p::report(out);
+  std::rewind(out);
+  std::string text;
+  char buffer[256];
+  while (std::fgets(buffer, sizeof(buffer), out) != nullptr) {
+    text += buffer;
+  }
+  std::fclose(out);
+
+  EXPECT_NE(text.find("CONTRACT PROFILE"), std::string::npos);
+  EXPECT_NE(text.find("(profiled_cheap)"), std::string::npos);
+  EXPECT_NE(text.find(p::time_unit()), std::string::npos);
+}
@@ -0,0 +1,126 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ratio>
+#include <type_traits>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/nonnegative_real.hpp"
+#include "contracts_lite/types/quantity.hpp"
+#include "contracts_lite/types/strictly_positive_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+namespace u = contracts_lite::units;
+namespace d = contracts_lite::dimensions;
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Quantity_construction) {
+  using Distance = u::Meters<c::NonnegativeReal<float>>;
+  using Duration = u::Seconds<c::StrictlyPositiveReal<float>>;
+  EXPECT_NO_THROW({
+    Distance(0.0f);
+    Distance(12.5f);
+    Duration(1e-9f);
+    u::Meters<>(-3.0f);
+  });
+  EXPECT_THROW({ Distance(-1.0f); }, std::runtime_error);
+  EXPECT_THROW({ Duration(0.0f); }, std::runtime_error);
+  EXPECT_THROW({ Distance(-1.0f, c::assume_valid); }, std::runtime_error);
+  EXPECT_FLOAT_EQ(Distance(2.0f).count(), 2.0f);
+  EXPECT_FLOAT_EQ(Distance(2.0f).value(), 2.0f);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Quantity_scale_conversions) {
+  const u::Millimeters<> mm(1500.0f);
+  const u::Meters<> m = mm;
+  EXPECT_FLOAT_EQ(m.count(), 1.5f);
+  EXPECT_FLOAT_EQ(u::Kilometers<>(m).count(), 0.0015f);
+  EXPECT_FLOAT_EQ(mm.count_in<std::ratio<1>>(), 1.5f);
+
+  const u::Nanoseconds<double> ns(2.5e9);
+  EXPECT_DOUBLE_EQ(u::Seconds<double>(ns).count(), 2.5);
+  EXPECT_DOUBLE_EQ(u::Microseconds<double>(ns).count(), 2.5e6);
+
+  static_assert(u::Meters<>::factor_from<std::milli>() == 0.001f, "");
+  static_assert(u::Millimeters<>::factor_from<std::ratio<1>>() == 1000.0f, "");
+
+  // Dimensions cannot be mixed up.
+  EXPECT_TRUE((std::is_convertible<u::Millimeters<>, u::Meters<>>::value));
+  EXPECT_FALSE((std::is_convertible<u::Seconds<>, u::Meters<>>::value));
+  EXPECT_FALSE((std::is_convertible<float, u::Meters<>>::value));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Quantity_conversion_checks_contract) {
+  using Distance = u::Meters<c::NonnegativeReal<float>>;
+  using Duration = u::Seconds<c::StrictlyPositiveReal<float>>;
+  EXPECT_NO_THROW({ Distance(u::Millimeters<>(5.0f)); });
+  EXPECT_THROW({ Distance(u::Millimeters<>(-5.0f)); }, std::runtime_error);
+  // A positive duration that underflows to zero when converted.
+  EXPECT_THROW({ Duration(u::Nanoseconds<>(1e-37f)); }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Quantity_arithmetic) {
+  using Distance = u::Meters<c::NonnegativeReal<float>>;
+  const Distance a(1.0f);
+  const u::Millimeters<> b(250.0f);
+
+  // Sums are in units of the finer scale, with the plain value type.
+  const auto sum = a + b;
+  static_assert(std::is_same<decltype(sum), const u::Millimeters<>>::value,
+                "");
+  EXPECT_FLOAT_EQ(sum.count(), 1250.0f);
+  EXPECT_FLOAT_EQ((a - b).count(), 750.0f);
+  EXPECT_FLOAT_EQ((-b).count(), -250.0f);
+  EXPECT_FLOAT_EQ((a * 3.0f).count(), 3.0f);
+  EXPECT_FLOAT_EQ((2.0f * b).count(), 500.0f);
+  EXPECT_FLOAT_EQ((b / 5.0f).count(), 50.0f);
+
+  const u::Seconds<> t(2.0f);
+  const u::MetersPerSecond<> v = a / t;
+  EXPECT_FLOAT_EQ(v.count(), 0.5f);
+  const u::MetersPerSecondSquared<> acc = v / t;
+  EXPECT_FLOAT_EQ(acc.count(), 0.25f);
+  const auto area = a * b;
+  static_assert(std::is_same<decltype(area)::dimension,
+                             c::Dimension<2, 0, 0>>::value,
+                "");
+  static_assert(std::is_same<decltype(area)::scale, std::milli>::value, "");
+  EXPECT_FLOAT_EQ(area.count(), 250.0f);
+  const auto ratio = b / a;
+  static_assert(
+      std::is_same<decltype(ratio)::dimension, d::Dimensionless>::value, "");
+  EXPECT_FLOAT_EQ(ratio.count_in<std::ratio<1>>(), 0.25f);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Quantity_comparisons) {
+  const u::Meters<> m(1.0f);
+  const u::Millimeters<> mm(1000.0f);
+  const u::Millimeters<> less(999.0f);
+  EXPECT_TRUE(m == mm);
+  EXPECT_FALSE(m != mm);
+  EXPECT_TRUE(less < m);
+  EXPECT_TRUE(less <= m);
+  EXPECT_TRUE(m > less);
+  EXPECT_TRUE(m >= mm);
+}
@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "contracts_lite/range_checks.hpp"
 #include "gtest/gtest.h"
@@ -190,3 +192,70 @@ TEST(Contracts_Lite, in_range_closed_closed) {
 }
 
 //------------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * @brief Check the integer range checks, which use a single unsigned compare,
+ * against the built-in comparisons, for every value of 'T' (or values near
+ * the bounds and the limits, for wide types) and bounds that include the
+ * limits of 'T' and empty intervals.
+ */
+template <typename T>
+void expect_integer_checks_match_comparisons() {
+  using limits = std::numeric_limits<T>;
+  const std::vector<T> bounds = {limits::min(),
+                                 static_cast<T>(limits::min() + 1),
+                                 static_cast<T>(0),
+                                 static_cast<T>(1),
+                                 static_cast<T>(limits::max() / 2),
+                                 static_cast<T>(limits::max() - 1),
+                                 limits::max()};
+  std::vector<T> values;
+  if (sizeof(T) == 1) {
+    for (int v = limits::min(); v <= limits::max(); ++v) {
+      values.push_back(static_cast<T>(v));
+    }
+  } else {
+    for (const T b : bounds) {
+      values.push_back(b);
+      values.push_back(static_cast<T>(b - 1));
+      values.push_back(static_cast<T>(b + 1));
+    }
+  }
+  for (const T min : bounds) {
+    for (const T max : bounds) {
+      for (const T v : values) {
+        EXPECT_EQ(r::in_range_open_open(v, min, max).status,
+                  (min < v) && (v < max))
+            << +v << " in (" << +min << ", " << +max << ")";
+        EXPECT_EQ(r::in_range_closed_open(v, min, max).status,
+                  (min <= v) && (v < max))
+            << +v << " in [" << +min << ", " << +max << ")";
+        EXPECT_EQ(r::in_range_open_closed(v, min, max).status,
+                  (min < v) && (v <= max))
+            << +v << " in (" << +min << ", " << +max << "]";
+        EXPECT_EQ(r::in_range_closed_closed(v, min, max).status,
+                  (min <= v) && (v <= max))
+            << +v << " in [" << +min << ", " << +max << "]";
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(Contracts_Lite, in_range_integers) {
+  expect_integer_checks_match_comparisons<std::int8_t>();
+  expect_integer_checks_match_comparisons<std::uint8_t>();
+  expect_integer_checks_match_comparisons<int>();
+  expect_integer_checks_match_comparisons<unsigned>();
+  expect_integer_checks_match_comparisons<std::int64_t>();
+  expect_integer_checks_match_comparisons<std::size_t>();
+}
+
+TEST(Contracts_Lite, in_range_integers_cast_to_bounds_type) {
+  // A negative value is cast to the (unsigned) bounds type, as before.
+  EXPECT_FALSE(r::in_range_closed_closed(-1, std::size_t{0}, std::size_t{10}));
+  EXPECT_TRUE(r::in_range_closed_closed(5, std::size_t{0}, std::size_t{10}));
+}
@@ -0,0 +1,149 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <ratio>
+#include <type_traits>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/acute_degree.hpp"
+#include "contracts_lite/types/ranged.hpp"
+#include "contracts_lite/types/size_bound.hpp"
+#include "contracts_lite/types/unit_real.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+template <std::intmax_t Lo, std::intmax_t Hi>
+using RangedD = c::Ranged<double, std::ratio<Lo>, std::ratio<Hi>>;
+
+template <std::intmax_t Lo, std::intmax_t Hi>
+using RangedZ = c::Ranged<std::size_t, std::ratio<Lo>, std::ratio<Hi>>;
+
+using Third = c::Ranged<double, std::ratio<0>, std::ratio<1, 3>>;
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Ranged_construction) {
+  using Unit = RangedD<0, 1>;
+  using Signed = RangedD<-2, 3>;
+  using Index = RangedZ<1, 10>;
+  EXPECT_NO_THROW({
+    Unit(0.0);
+    Unit(1.0);
+    Signed(-2.0);
+    Index(10);
+    Third(1.0 / 3.0);
+  });
+  EXPECT_THROW({ Unit(1.5); }, std::runtime_error);
+  EXPECT_THROW({ Unit(-0.1); }, std::runtime_error);
+  EXPECT_THROW({ Unit(std::nan("")); }, std::runtime_error);
+  EXPECT_THROW({ Index(0); }, std::runtime_error);
+  EXPECT_THROW({ Unit(2.0, c::assume_valid); }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Ranged_interval_arithmetic) {
+  const RangedD<0, 1> a(0.25);
+  const RangedD<-2, 3> b(-1.5);
+  const RangedD<2, 4> d(2.0);
+
+  static_assert(std::is_same<decltype(a + a), RangedD<0, 2>>::value, "");
+  static_assert(std::is_same<decltype(a - b), RangedD<-3, 3>>::value, "");
+  static_assert(std::is_same<decltype(a * b), RangedD<-2, 3>>::value, "");
+  static_assert(std::is_same<decltype(b * b), RangedD<-6, 9>>::value, "");
+  static_assert(std::is_same<decltype(-b), RangedD<-3, 2>>::value, "");
+  using Quotient = c::Ranged<double, std::ratio<-1>, std::ratio<3, 2>>;
+  static_assert(std::is_same<decltype(b / d), Quotient>::value, "");
+  static_assert(std::is_same<decltype(RangedZ<1, 10>(2) * RangedZ<0, 3>(1)),
+                             RangedZ<0, 30>>::value,
+                "");
+
+  EXPECT_DOUBLE_EQ(a + a, 0.5);
+  EXPECT_DOUBLE_EQ(a - b, 1.75);
+  EXPECT_DOUBLE_EQ(a * b, -0.375);
+  EXPECT_DOUBLE_EQ(-b, 1.5);
+  EXPECT_DOUBLE_EQ(b / d, -0.75);
+  using Index = RangedZ<1, 10>;
+  using Offset = RangedZ<0, 3>;
+  EXPECT_EQ(Index(2) + Offset(3), 5u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Ranged_inexact_bounds_are_clamped) {
+  static_assert(!Third::is_exact(), "");
+  static_assert(RangedD<0, 1>::is_exact(), "");
+  static_assert(c::Ranged<float, std::ratio<1, 4>, std::ratio<1>>::is_exact(),
+                "");
+  // Each third rounds down, but their sum may round up past 1.
+  const Third t(Third::max());
+  EXPECT_NO_THROW({
+    const auto s = t + t + t;
+    EXPECT_LE(static_cast<double>(s), decltype(s)::max());
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Ranged_conversions) {
+  using Wide = RangedD<-1, 2>;
+  EXPECT_TRUE((std::is_convertible<RangedD<0, 1>, Wide>::value));
+  EXPECT_FALSE((std::is_convertible<RangedD<0, 3>, Wide>::value));
+  EXPECT_TRUE((std::is_convertible<c::UnitReal<double>, RangedD<0, 1>>::value));
+  EXPECT_FALSE((std::is_convertible<c::UnitReal<double>, Third>::value));
+
+  const Wide w = RangedD<0, 1>(0.5);
+  EXPECT_DOUBLE_EQ(w, 0.5);
+  const auto u = c::make_ranged(c::UnitReal<double>(0.75));
+  static_assert(std::is_same<decltype(u), const RangedD<0, 1>>::value, "");
+  const auto deg = c::make_ranged(c::AcuteDegree<double>(30.0));
+  static_assert(std::is_same<decltype(deg), const RangedD<0, 90>>::value, "");
+  EXPECT_DOUBLE_EQ(u + deg, 30.75);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, Ranged_narrow) {
+  using Unit = c::UnitReal<double>;
+  using Acute = c::AcuteDegree<double>;
+  static_assert(RangedD<0, 1>::is_subset_of<Unit>(), "");
+  static_assert(!RangedD<0, 2>::is_subset_of<Unit>(), "");
+  static_assert(RangedD<0, 89>::is_subset_of<Acute>(), "");
+  static_assert(!RangedD<0, 90>::is_subset_of<Acute>(), "");
+  static_assert(RangedZ<0, 255>::is_subset_of<c::SizeBound<255>>(), "");
+  static_assert(!RangedZ<0, 256>::is_subset_of<c::SizeBound<255>>(), "");
+
+  const RangedD<0, 1> a(0.5);
+  EXPECT_DOUBLE_EQ(c::narrow<Unit>(a * a), 0.25);
+  EXPECT_DOUBLE_EQ(c::narrow<Unit>(a + a), 1.0);
+  EXPECT_THROW({ c::narrow<Unit>(a + a + a); }, std::runtime_error);
+  EXPECT_DOUBLE_EQ(c::narrow<Acute>(RangedD<0, 90>(45.0)), 45.0);
+  EXPECT_THROW({ c::narrow<Acute>(RangedD<0, 90>(90.0)); },
+               std::runtime_error);
+
+  const RangedZ<0, 200> i(200);
+  EXPECT_EQ(c::narrow<c::SizeBound<255>>(i), 200u);
+  EXPECT_THROW({ c::narrow<c::SizeBound<255>>(i + i); }, std::runtime_error);
+  using Byte = RangedZ<0, 255>;
+  using Offset = RangedZ<0, 100>;
+  EXPECT_EQ(c::narrow<Byte>(i + Offset(55)), 255u);
+}
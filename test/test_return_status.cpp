@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <limits>
+#include <sstream>
 #include <string>
 
 #include "contracts_lite/operators.hpp"
@@ -91,3 +92,17 @@ TEST(Contracts_Lite, ReturnStatus) {
     }
   }
 }
+
+TEST(Contracts_Lite, ContractViolation_string) {
+  const contracts_lite::ContractViolation violation(42, "comment", "DEFAULT",
+                                                    "OFF", "file.cpp", "foo");
+  const std::string expected =
+      "{comment: \"comment\", function_name: \"foo\", file_name: "
+      "\"file.cpp\", line_number: \"42\", assertion_level: \"DEFAULT\", "
+      "violation_continuation_mode: \"OFF\"}";
+  EXPECT_EQ(contracts_lite::ContractViolation::string(violation), expected);
+
+  std::ostringstream os;
+  os << violation;
+  EXPECT_EQ(os.str(), expected);
+}
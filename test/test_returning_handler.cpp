@@ -0,0 +1,105 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Tests with a violation handler that returns, which the contract types must
+// handle without storing invalid values. The handler is defined before the
+// headers are included, so these tests are built separately.
+
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "contracts_lite/return_status.hpp"
+
+namespace {
+
+std::vector<std::string> violations;
+
+/** @brief Records the violation and returns. */
+void record_violation(const contracts_lite::ContractViolation& violation) {
+  violations.push_back(contracts_lite::ContractViolation::string(violation));
+}
+
+}  // namespace
+
+#define CONTRACT_VIOLATION_HANDLER(violation) record_violation(violation)
+
+#include "contracts_lite/enforcement.hpp"
+#include "contracts_lite/types/bounded_vector.hpp"
+#include "contracts_lite/types/covariance_matrix.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_ReturningHandler, CovarianceMatrix_modify) {
+  using C2 = c::CovarianceMatrix<double, 2>;
+  violations.clear();
+  auto m = C2::isotropic(1.0);
+  m.modify([](std::array<double, 4>& a) { a[0] = -5.0; });
+  EXPECT_EQ(violations.size(), 1u);
+  EXPECT_EQ(m.array()[0], 1.0);
+  EXPECT_TRUE(C2::is_valid(m.array()));
+
+  m.modify([](std::array<double, 4>& a) { a[0] = 3.0; });
+  EXPECT_EQ(violations.size(), 1u);
+  EXPECT_EQ(m.array()[0], 3.0);
+}
+
+TEST(Contract_ReturningHandler, CovarianceMatrix_sum) {
+  using C2 = c::CovarianceMatrix<double, 2>;
+  violations.clear();
+  const auto huge = C2::isotropic(std::numeric_limits<double>::max());
+  huge + huge;
+  EXPECT_EQ(violations.size(), 1u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_ReturningHandler, BoundedVector_grow_past_capacity) {
+  using V = c::BoundedVector<int, 2>;
+  violations.clear();
+  V v{1, 2};
+  v.push_back(3);
+  EXPECT_EQ(violations.size(), 1u);
+  EXPECT_EQ(v.emplace_back(4), 2);
+  EXPECT_EQ(violations.size(), 2u);
+  v.resize(3);
+  EXPECT_EQ(violations.size(), 3u);
+  v.resize(3, 5);
+  EXPECT_EQ(violations.size(), 4u);
+  ASSERT_EQ(v.size(), 2u);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[1], 2);
+
+  const V too_long{1, 2, 3};
+  EXPECT_EQ(violations.size(), 5u);
+  EXPECT_TRUE(too_long.empty());
+}
+
+TEST(Contract_ReturningHandler, BoundedVector_pop_back_empty) {
+  using V = c::BoundedVector<std::string, 2>;
+  violations.clear();
+  V v;
+  v.pop_back();
+  EXPECT_EQ(violations.size(), 1u);
+  EXPECT_TRUE(v.empty());
+  v.push_back("a");
+  EXPECT_EQ(violations.size(), 1u);
+  EXPECT_EQ(v.back(), "a");
+}
+
+//------------------------------------------------------------------------------
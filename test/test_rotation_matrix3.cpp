@@ -0,0 +1,96 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/rotation_matrix3.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+using R = c::RotationMatrix3<double>;
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, RotationMatrix3_double) {
+  // Not orthonormal.
+  EXPECT_THROW({ R(std::array<double, 9>{{1, 0, 0, 0, 2, 0, 0, 0, 1}}); },
+               std::runtime_error);
+  EXPECT_THROW({ R(std::array<double, 9>{{1, 1, 0, 0, 1, 0, 0, 0, 1}}); },
+               std::runtime_error);
+  // Reflection.
+  EXPECT_THROW({ R(std::array<double, 9>{{1, 0, 0, 0, 1, 0, 0, 0, -1}}); },
+               std::runtime_error);
+  EXPECT_NO_THROW({
+    R(std::array<double, 9>{{1, 0, 0, 0, 1, 0, 0, 0, 1}});
+    R(std::array<double, 9>{{0, -1, 0, 1, 0, 0, 0, 0, 1}});
+    R::identity();
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, RotationMatrix3_operations) {
+  using Q = c::UnitQuaternion<double>;
+  using V = c::UnitVector3<double>;
+  const auto axis = V::normalize(1.0, -2.0, 0.5);
+  const auto q = Q::from_axis_angle(axis, 0.7);
+  const auto m = R(q);
+
+  const auto x = V(1.0, 0.0, 0.0);
+  const auto by_q = q.rotate(x);
+  const auto by_m = m * x;
+  EXPECT_NEAR(by_q.x(), by_m.x(), 1e-12);
+  EXPECT_NEAR(by_q.y(), by_m.y(), 1e-12);
+  EXPECT_NEAR(by_q.z(), by_m.z(), 1e-12);
+
+  const auto identity = m * m.transpose();
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      EXPECT_NEAR(identity(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+    }
+  }
+
+  // Repeated products accumulate rounding error, which re-orthonormalization
+  // removes.
+  const auto axis_f = c::UnitVector3<float>::normalize(1.0f, 2.0f, 3.0f);
+  const auto step = c::RotationMatrix3<float>(
+      c::UnitQuaternion<float>::from_axis_angle(axis_f, 0.001f));
+  auto r = c::RotationMatrix3<float>::identity();
+  for (int i = 0; i < 100000; ++i) {
+    r = r * step;
+  }
+  EXPECT_TRUE(c::RotationMatrix3<float>::is_valid(r.array()));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, RotationMatrix3_batch) {
+  std::vector<double> data;
+  for (int i = 0; i < 10; ++i) {
+    const auto a = 0.3 * i;
+    data.insert(data.end(), {std::cos(a), -std::sin(a), 0.0, std::sin(a),
+                             std::cos(a), 0.0, 0.0, 0.0, 1.0});
+  }
+  EXPECT_TRUE(R::check_batch(data.data(), 10));
+  data[9 * 5 + 8] = -1.0;
+  EXPECT_FALSE(R::check_batch(data.data(), 10));
+
+  const std::vector<R> ms(4, R::identity());
+  EXPECT_TRUE(R::check_batch(ms.data(), ms.size()));
+}
+
+//------------------------------------------------------------------------------
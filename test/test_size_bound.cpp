@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
+
 #include "contracts_lite/simple_violation_handler.hpp"
 #include "contracts_lite/types/size_bound.hpp"
 
@@ -19,6 +21,19 @@
 
 namespace c = contracts_lite;
 
+static constexpr size_t U16_END = static_cast<size_t>(UINT16_MAX) + 1;
+static constexpr size_t U32_END = static_cast<size_t>(UINT32_MAX) + 1;
+
+static_assert(sizeof(c::SizeBound<0>) == 1, "Storage must be compact");
+static_assert(sizeof(c::SizeBound<255>) == 1, "Storage must be compact");
+static_assert(sizeof(c::SizeBound<256>) == 2, "Storage must be compact");
+static_assert(sizeof(c::SizeBound<UINT16_MAX>) == 2, "Storage must be compact");
+static_assert(sizeof(c::SizeBound<U16_END>) == 4, "Storage must be compact");
+static_assert(sizeof(c::SizeBound<UINT32_MAX>) == 4, "Storage must be compact");
+static_assert(sizeof(c::SizeBound<U32_END>) == 8, "Storage must be compact");
+static_assert(sizeof(c::SizeBound<SIZE_MAX>) == sizeof(size_t),
+              "Storage must be compact");
+
 //------------------------------------------------------------------------------
 
 TEST(Contract_Types, SizeBound) {
@@ -37,3 +52,20 @@ TEST(Contract_Types, SizeBound) {
 }
 
 //------------------------------------------------------------------------------
+
+TEST(Contract_Types, SizeBound_compact) {
+  // Out of range values must not pass the check after being truncated.
+  EXPECT_THROW({ c::SizeBound<255>{256}; }, std::runtime_error);
+  EXPECT_THROW({ c::SizeBound<255>{256 + 5}; }, std::runtime_error);
+  EXPECT_THROW({ c::SizeBound<UINT16_MAX>{UINT32_MAX}; }, std::runtime_error);
+  EXPECT_NO_THROW({
+    c::SizeBound<255> s{255};
+    EXPECT_EQ(static_cast<size_t>(s), 255u);
+  });
+  EXPECT_NO_THROW({
+    c::SizeBound<UINT32_MAX> s{UINT32_MAX};
+    EXPECT_EQ(static_cast<size_t>(s), static_cast<size_t>(UINT32_MAX));
+  });
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,90 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/unit_quaternion.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+static constexpr auto NaNf = std::numeric_limits<float>::quiet_NaN();
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, UnitQuaternion_float) {
+  using Q = c::UnitQuaternion<float>;
+  EXPECT_THROW({ Q(0.0f, 0.0f, 0.0f, 0.0f); }, std::runtime_error);
+  EXPECT_THROW({ Q(1.0f, 1.0f, 0.0f, 0.0f); }, std::runtime_error);
+  EXPECT_THROW({ Q(NaNf, 0.0f, 0.0f, 0.0f); }, std::runtime_error);
+  EXPECT_THROW({ Q(0.5f, 0.0f, 0.0f, 0.0f, c::assume_valid); },
+               std::runtime_error);
+  EXPECT_NO_THROW({
+    Q(1.0f, 0.0f, 0.0f, 0.0f);
+    Q(0.5f, 0.5f, 0.5f, 0.5f);
+    Q::identity();
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, UnitQuaternion_operations) {
+  using Q = c::UnitQuaternion<float>;
+  using V = c::UnitVector3<float>;
+  const auto z = V(0.0f, 0.0f, 1.0f);
+  const auto quarter = Q::from_axis_angle(z, static_cast<float>(M_PI_2));
+
+  const auto v = quarter.rotate(V(1.0f, 0.0f, 0.0f));
+  EXPECT_NEAR(v.x(), 0.0f, 1e-6f);
+  EXPECT_NEAR(v.y(), 1.0f, 1e-6f);
+  EXPECT_NEAR(v.z(), 0.0f, 1e-6f);
+
+  const auto identity = quarter * quarter.conjugate();
+  EXPECT_NEAR(identity.w(), 1.0f, 1e-6f);
+
+  // The angle must be finite.
+  const auto inf = std::numeric_limits<float>::infinity();
+  EXPECT_THROW({ Q::from_axis_angle(z, inf); }, std::runtime_error);
+  EXPECT_THROW({ Q::from_axis_angle(z, std::nanf("")); }, std::runtime_error);
+
+  // Repeated products accumulate rounding error, which renormalization
+  // removes.
+  const auto axis = V::normalize(1.0f, 2.0f, 3.0f);
+  const auto step = Q::from_axis_angle(axis, 0.001f);
+  auto q = Q::identity();
+  for (int i = 0; i < 100000; ++i) {
+    q = q * step;
+  }
+  EXPECT_TRUE(Q::is_valid(q.array()));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, UnitQuaternion_batch) {
+  std::vector<double> data(4 * 10, 0.0);
+  for (int i = 0; i < 10; ++i) {
+    data[4 * i + (i % 4)] = 1.0;
+  }
+  EXPECT_TRUE(c::UnitQuaternion<double>::check_batch(data.data(), 10));
+  data[4 * 7] = 0.9;
+  EXPECT_FALSE(c::UnitQuaternion<double>::check_batch(data.data(), 10));
+
+  using Q = c::UnitQuaternion<double>;
+  const std::vector<Q> qs(5, Q::identity());
+  EXPECT_TRUE(Q::check_batch(qs.data(), qs.size()));
+}
+
+//------------------------------------------------------------------------------
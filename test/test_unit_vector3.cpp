@@ -0,0 +1,79 @@
+// Copyright 2021 Mapless AI, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "contracts_lite/simple_violation_handler.hpp"
+#include "contracts_lite/types/unit_vector3.hpp"
+#include "gtest/gtest.h"
+
+namespace c = contracts_lite;
+static constexpr auto NaNf = std::numeric_limits<float>::quiet_NaN();
+static constexpr auto INFf = std::numeric_limits<float>::infinity();
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, UnitVector3_float) {
+  EXPECT_THROW({ c::UnitVector3<float>(0.0f, 0.0f, 0.0f); },
+               std::runtime_error);
+  EXPECT_THROW({ c::UnitVector3<float>(1.0f, 1.0f, 0.0f); },
+               std::runtime_error);
+  EXPECT_THROW({ c::UnitVector3<float>(NaNf, 0.0f, 0.0f); },
+               std::runtime_error);
+  EXPECT_THROW({ c::UnitVector3<float>(INFf, 0.0f, 0.0f); },
+               std::runtime_error);
+  EXPECT_THROW({ c::UnitVector3<float>::normalize(0.0f, 0.0f, 0.0f); },
+               std::runtime_error);
+  EXPECT_THROW({ c::UnitVector3<float>(2.0f, 0.0f, 0.0f, c::assume_valid); },
+               std::runtime_error);
+  EXPECT_NO_THROW({
+    c::UnitVector3<float>(1.0f, 0.0f, 0.0f);
+    c::UnitVector3<float>(0.0f, -1.0f, 0.0f);
+    c::UnitVector3<float>(0.6f, 0.0f, 0.8f);
+    c::UnitVector3<float>(1.000004f, 0.0f, 0.0f);
+    const auto v = c::UnitVector3<float>::normalize(1.0f, 2.0f, 3.0f);
+    EXPECT_NEAR(v.dot(v), 1.0f, 1e-6f);
+    EXPECT_FLOAT_EQ((-v).x(), -v.x());
+  });
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, UnitVector3_tolerance) {
+  using Loose = c::UnitVector3<double, std::ratio<1, 10>>;
+  EXPECT_NO_THROW({ Loose(1.04, 0.0, 0.0); });
+  EXPECT_THROW({ c::UnitVector3<double>(1.04, 0.0, 0.0); }, std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(Contract_Types, UnitVector3_batch) {
+  std::vector<float> data;
+  for (int i = 0; i < 100; ++i) {
+    const auto angle = 0.1f * static_cast<float>(i);
+    data.insert(data.end(), {std::cos(angle), std::sin(angle), 0.0f});
+  }
+  EXPECT_TRUE(c::UnitVector3<float>::check_batch(data.data(), 100));
+  EXPECT_TRUE(c::UnitVector3<float>::check_batch(data.data(), 0));
+  data[3 * 42 + 2] = 0.5f;
+  EXPECT_FALSE(c::UnitVector3<float>::check_batch(data.data(), 100));
+  EXPECT_TRUE(c::UnitVector3<float>::check_batch(data.data(), 42));
+
+  const std::vector<c::UnitVector3<float>> vs(3, {0.0f, 0.0f, 1.0f});
+  EXPECT_TRUE(c::UnitVector3<float>::check_batch(vs.data(), vs.size()));
+}
+
+//------------------------------------------------------------------------------